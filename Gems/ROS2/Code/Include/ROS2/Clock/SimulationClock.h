@@ -8,9 +8,11 @@
 #pragma once
 
 #include <AzCore/std/chrono/chrono.h>
-#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <ROS2/Clock/SlidingWindowPercentiles.h>
 #include <builtin_interfaces/msg/time.hpp>
 #include <rclcpp/publisher.hpp>
+#include <rclcpp/publisher_base.hpp>
 #include <rosgraph_msgs/msg/clock.hpp>
 
 namespace ROS2
@@ -21,6 +23,16 @@ namespace ROS2
         static constexpr size_t FramesNumberForStats = 60;
 
     public:
+        using LoopTime = AZStd::chrono::duration<float, AZStd::chrono::seconds::period>;
+
+        //! Percentiles of simulation loop time over recent frames.
+        struct LoopTimePercentiles
+        {
+            LoopTime m_p50{ 0.0f };
+            LoopTime m_p95{ 0.0f };
+            LoopTime m_p99{ 0.0f };
+        };
+
         virtual void Activate(){};
         virtual void Deactivate(){};
 
@@ -34,16 +46,33 @@ namespace ROS2
 
         //! Returns an expected loop time of simulation. It is an estimation from past frames.
         AZStd::chrono::duration<float, AZStd::chrono::seconds::period> GetExpectedSimulationLoopTime() const;
+
+        //! Returns percentiles (p50, p95 and p99) of simulation loop time over the last frames.
+        //! Percentiles are updated on each Tick and can be read from any thread without locking.
+        LoopTimePercentiles GetSimulationLoopTimePercentiles() const;
+
         virtual ~SimulationClock() = default;
 
     private:
         //! Get the time since start of sim, scaled with t_simulationTickScale
         int64_t GetElapsedTimeMicroseconds() const;
 
+        //! Publish loop time percentiles to the ROS 2 `/diagnostics` topic, at most once per DiagnosticsPeriodMicroseconds.
+        void PublishDiagnostics(AZ::s64 elapsed);
+
+        static constexpr AZ::s64 DiagnosticsPeriodMicroseconds = 1000000;
+
         AZ::s64 m_lastExecutionTime{ 0 };
+        AZ::s64 m_lastDiagnosticsTime{ 0 };
 
         rclcpp::Publisher<rosgraph_msgs::msg::Clock>::SharedPtr m_clockPublisher;
-        AZ::s64 m_currentMedian{ 0 };
-        AZStd::deque<AZ::s64> m_frameTimes;
+        //! Publisher of diagnostic_msgs::msg::DiagnosticArray, held by its base type so that includers of this header do not depend on
+        //! diagnostic_msgs.
+        rclcpp::PublisherBase::SharedPtr m_diagnosticsPublisher;
+        SlidingWindowPercentiles<FramesNumberForStats> m_frameTimes;
+        //! Loop time percentiles in microseconds, written by Tick and read by any thread.
+        AZStd::atomic<AZ::s64> m_loopTimeP50{ 0 };
+        AZStd::atomic<AZ::s64> m_loopTimeP95{ 0 };
+        AZStd::atomic<AZ::s64> m_loopTimeP99{ 0 };
     };
 } // namespace ROS2
\ No newline at end of file
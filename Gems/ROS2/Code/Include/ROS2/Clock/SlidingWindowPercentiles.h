@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+
+namespace ROS2
+{
+    //! Order statistics (median and other percentiles) of the last WindowSize samples.
+    //! Samples are kept both in arrival order, to know which one expires, and sorted, so that any percentile is read in constant time.
+    //! Adding a sample finds its position with a binary search and shifts at most WindowSize elements. Nothing is allocated.
+    template<size_t WindowSize>
+    class SlidingWindowPercentiles
+    {
+        static_assert(WindowSize > 0, "Window of samples must not be empty");
+
+    public:
+        //! Adds a sample, replacing the oldest one if the window is full.
+        void AddSample(AZ::s64 sample)
+        {
+            if (m_count == WindowSize)
+            {
+                const AZ::s64 expiredSample = m_samples[m_next];
+                auto sortedEnd = m_sorted.begin() + m_count;
+                auto expired = AZStd::lower_bound(m_sorted.begin(), sortedEnd, expiredSample);
+                AZStd::move(expired + 1, sortedEnd, expired);
+                --m_count;
+            }
+
+            m_samples[m_next] = sample;
+            m_next = (m_next + 1) % WindowSize;
+
+            auto sortedEnd = m_sorted.begin() + m_count;
+            auto inserted = AZStd::upper_bound(m_sorted.begin(), sortedEnd, sample);
+            AZStd::move_backward(inserted, sortedEnd, sortedEnd + 1);
+            *inserted = sample;
+            ++m_count;
+        }
+
+        //! Get a percentile of samples in the window, using the nearest-rank method.
+        //! @param fraction Percentile as a fraction in range [0, 1] (e.g. 0.5 for the median).
+        //! @return Sample at the percentile, or zero if there are no samples.
+        AZ::s64 GetPercentile(float fraction) const
+        {
+            if (m_count == 0)
+            {
+                return 0;
+            }
+            const size_t rank = aznumeric_cast<size_t>(AZStd::clamp(fraction, 0.0f, 1.0f) * aznumeric_cast<float>(m_count));
+            return m_sorted[AZStd::min(rank, m_count - 1)];
+        }
+
+        //! Get the number of samples in the window.
+        size_t GetSampleCount() const
+        {
+            return m_count;
+        }
+
+    private:
+        AZStd::array<AZ::s64, WindowSize> m_samples{}; //!< Ring buffer of samples in arrival order.
+        AZStd::array<AZ::s64, WindowSize> m_sorted{}; //!< Samples in the window in ascending order.
+        size_t m_next = 0; //!< Index in m_samples of the next sample to write.
+        size_t m_count = 0; //!< Number of samples in the window.
+    };
+} // namespace ROS2
@@ -8,22 +8,28 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TransformBus.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <ROS2/Frame/NamespaceConfiguration.h>
 #include <ROS2/Frame/ROS2Transform.h>
+#include <ROS2/ROS2Bus.h>
 #include <ROS2/ROS2GemUtilities.h>
 
 namespace ROS2
 {
     //! This component marks an interesting reference frame for ROS2 ecosystem.
-    //! It serves as sensor data frame of reference and is responsible, through ROS2Transform, for publishing
-    //! ros2 static and dynamic transforms (/tf_static, /tf). It also facilitates namespace handling.
+    //! It serves as sensor data frame of reference and is responsible for publishing ros2 static transforms (/tf_static) through
+    //! ROS2Transform, and dynamic transforms (/tf) through the batched publisher of the ROS2SystemComponent, or through ROS2Transform
+    //! on each tick if the batched publisher is not available. It also facilitates namespace handling.
+    //! The parent frame and its id are resolved on activation and each time the entity is re-parented, so that a published transform
+    //! always matches the frame ids it was registered with.
     //! An entity can only have a single ROS2Frame on each level. Many ROS2 Components require this component.
     //! @note A robot should have this component on every level of entity hierarchy (for each joint, fixed or dynamic)
     class ROS2FrameComponent
         : public AZ::Component
         , public AZ::TickBus::Handler
+        , public AZ::TransformNotificationBus::Handler
     {
     public:
         AZ_COMPONENT(ROS2FrameComponent, "{EE743472-3E25-41EA-961B-14096AC1D66F}");
@@ -85,6 +91,23 @@ namespace ROS2
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
         //////////////////////////////////////////////////////////////////////////
 
+        //////////////////////////////////////////////////////////////////////////
+        // AZ::TransformNotificationBus::Handler overrides
+        void OnParentChanged(AZ::EntityId oldParent, AZ::EntityId newParent) override;
+        //////////////////////////////////////////////////////////////////////////
+
+        //! Resolve the parent frame in the current hierarchy and cache its transform interface and frame id.
+        void CacheParentFrame();
+
+        //! Start publishing the transform between the cached parent frame and this frame.
+        void StartTransformPublication();
+
+        //! Stop publishing the transform started with StartTransformPublication.
+        void StopTransformPublication();
+
+        //! Get a transform between this frame and the cached parent frame, without walking the entity hierarchy.
+        AZ::Transform GetCachedFrameTransform() const;
+
         bool IsTopLevel() const; //!< True if this entity does not have a parent entity with ROS2.
 
         //! Whether transformation to parent frame can change during the simulation, or is fixed.
@@ -105,5 +128,14 @@ namespace ROS2
         bool m_publishTransform = true;
         bool m_isDynamic = false;
         AZStd::unique_ptr<ROS2Transform> m_ros2Transform;
+        //! Id of the dynamic transform registered for publishing, valid only for dynamic frames.
+        ROS2Requests::DynamicTransformId m_dynamicTransformId = ROS2Requests::InvalidDynamicTransformId;
+
+        //! Transform interface of this entity, valid while the component is active.
+        AZ::TransformInterface* m_transformInterface = nullptr;
+        //! Transform interface of the parent frame entity, nullptr for a top level frame.
+        AZ::TransformInterface* m_parentTransformInterface = nullptr;
+        //! Frame id of the parent frame, cached together with m_parentTransformInterface.
+        AZStd::string m_parentFrameId;
     };
 } // namespace ROS2
@@ -88,6 +88,10 @@ namespace ROS2
     {
         Points = (1 << 0), //!< return 3D point coordinates
         Ranges = (1 << 1), //!< return array of distances
+        LocalFramePoints = (1 << 2), //!< return 3D point coordinates in the lidar reference frame instead of the world frame
+        Intensity = (1 << 3), //!< return intensity of each point, derived from the physics material of the hit surface
+        Ring = (1 << 4), //!< return ring (lidar template layer index) of each point
+        TimeOffset = (1 << 5), //!< return time offset of each point relative to the beginning of the scan
     };
 
     //! Bitwise operators for RaycastResultFlags
@@ -97,6 +101,10 @@ namespace ROS2
     {
         AZStd::vector<AZ::Vector3> m_points;
         AZStd::vector<float> m_ranges;
+        //! Per-point channels, filled only when requested. Each of them has an element for every point in m_points.
+        AZStd::vector<float> m_intensities;
+        AZStd::vector<AZ::u16> m_rings;
+        AZStd::vector<float> m_timeOffsets; //!< Time offsets in seconds.
     };
 
     //! Interface class that allows for communication with a single Lidar instance.
@@ -121,6 +129,13 @@ namespace ROS2
             AZ_Assert(false, "This Lidar Implementation does not support minimum ray range configurations!");
         }
 
+        //! Configures rings reported for each ray when the RaycastResultFlags::Ring flag is requested.
+        //! @param rings Ring (lidar template layer index) of each ray, in the order of configured ray orientations.
+        virtual void ConfigureRayRings([[maybe_unused]] const AZStd::vector<AZ::u16>& rings)
+        {
+            AZ_Assert(false, "This Lidar Implementation does not support ray rings!");
+        }
+
         //! Configures result flags.
         //! @param flags Raycast result flags define set of data types returned by lidar.
         virtual void ConfigureRaycastResultFlags(RaycastResultFlags flags)
@@ -134,6 +149,31 @@ namespace ROS2
         //! @return Results of the raycast in the requested form including 3D space coordinates and/or ranges.
         virtual RaycastResult PerformRaycast(const AZ::Transform& lidarTransform) = 0;
 
+        //! Schedules a raycast that originates from the point described by the lidarTransform and stores its results in a caller-owned
+        //! buffer. Contents of the buffer are replaced, but its capacity is kept, so calling this method repeatedly with the same buffer
+        //! does not reallocate once the buffer has grown to the scan size.
+        //! @param lidarTransform Current transform from global to lidar reference frame.
+        //! @param results Buffer that receives results of the raycast in the requested form.
+        virtual void PerformRaycastInto(const AZ::Transform& lidarTransform, RaycastResult& results)
+        {
+            results = PerformRaycast(lidarTransform);
+        }
+
+        //! Schedules a raycast of a contiguous range of the configured rays and appends its results to a caller-owned buffer.
+        //! Used to spread a single scan over several calls, e.g. to simulate a rotating lidar with a rolling shutter.
+        //! @param lidarTransform Current transform from global to lidar reference frame.
+        //! @param firstRay Index of the first ray to cast, in the order of configured ray orientations.
+        //! @param rayCount Number of rays to cast.
+        //! @param results Buffer to which results of the raycast are appended in the requested form.
+        virtual void PerformPartialRaycastInto(
+            [[maybe_unused]] const AZ::Transform& lidarTransform,
+            [[maybe_unused]] size_t firstRay,
+            [[maybe_unused]] size_t rayCount,
+            [[maybe_unused]] RaycastResult& results)
+        {
+            AZ_Assert(false, "This Lidar Implementation does not support partial scans!");
+        }
+
         //! Configures ray Gaussian Noise parameters.
         //! Each call overrides the previous configuration.
         //! This type of noise is especially useful when trying to simulate real-life lidars, since its noise mimics
@@ -173,6 +213,13 @@ namespace ROS2
             AZ_Assert(false, "This Lidar Implementation does not support Max range point addition configuration!");
         }
 
+        //! Configures parallel dispatch of rays.
+        //! @param enabled Should the raycaster split each scan into chunks and process them concurrently?
+        virtual void ConfigureParallelDispatch([[maybe_unused]] bool enabled)
+        {
+            AZ_Assert(false, "This Lidar Implementation does not support parallel dispatch!");
+        }
+
         //! Enables and configures raycaster-side Point Cloud Publisher.
         //! If not called, no publishing (raycaster-side) is performed. For some implementations it might be beneficial
         //! to publish internally (e.g. for the RGL gem, published points can be transformed from global to sensor
@@ -22,6 +22,11 @@ namespace ROS2
         EntityExclusion         = 1 << 2,
         MaxRangePoints          = 1 << 3,
         PointcloudPublishing    = 1 << 4,
+        ParallelDispatch        = 1 << 5,
+        SceneScheduling         = 1 << 6,
+        LocalFramePoints        = 1 << 7,
+        PartialScans            = 1 << 8,
+        PointFields             = 1 << 9,
         All                     = 0b1111111111111111,
     };
 
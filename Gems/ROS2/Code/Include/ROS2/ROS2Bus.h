@@ -9,6 +9,9 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
 #include <builtin_interfaces/msg/time.hpp>
 #include <geometry_msgs/msg/transform_stamped.hpp>
 #include <ROS2/Clock/SimulationClock.h>
@@ -27,6 +30,13 @@ namespace ROS2
         AZ_RTTI(ROS2Requests, "{a9bdbff6-e644-430d-8096-cdb53c88e8fc}");
         virtual ~ROS2Requests() = default;
 
+        //! Identifier of a registered dynamic transform.
+        using DynamicTransformId = AZ::u64;
+        //! Identifier returned when a dynamic transform could not be registered.
+        static constexpr DynamicTransformId InvalidDynamicTransformId = 0;
+        //! Function returning the current transform between parent and child frames of a dynamic transform.
+        using DynamicTransformGetter = AZStd::function<AZ::Transform()>;
+
         //! Get a central ROS2 node of the Gem.
         //! You can use this node to create publishers and subscribers.
         //! @return The central ROS2 node which holds default publishers for core topics such as /clock and /tf.
@@ -52,10 +62,31 @@ namespace ROS2
         //! Use this function directly only when default behavior of ROS2FrameComponent is not sufficient.
         virtual void BroadcastTransform(const geometry_msgs::msg::TransformStamped& t, bool isDynamic) const = 0;
 
+        //! Register a dynamic transformation between ROS2 frames.
+        //! All registered transforms are published once per tick, with a single timestamp, in one tf2 message on /tf.
+        //! @param parentFrame id of the parent frame of the transformation.
+        //! @param childFrame id of the child frame of the transformation.
+        //! @param getTransform function returning the current transformation from the child to the parent frame.
+        //! @return Id of the registered transform, needed to unregister it. The default implementation does not publish registered
+        //! transforms and returns InvalidDynamicTransformId, in which case the caller has to broadcast the transform on its own.
+        //! @note Dynamic transforms are already registered by each ROS2FrameComponent.
+        virtual DynamicTransformId RegisterDynamicTransform(
+            [[maybe_unused]] const AZStd::string& parentFrame,
+            [[maybe_unused]] const AZStd::string& childFrame,
+            [[maybe_unused]] DynamicTransformGetter getTransform)
+        {
+            return InvalidDynamicTransformId;
+        }
+
+        //! Unregister a dynamic transformation, so that it is no longer published.
+        //! @param transformId id returned by RegisterDynamicTransform.
+        virtual void UnregisterDynamicTransform([[maybe_unused]] DynamicTransformId transformId)
+        {
+        }
+
         //! Obtains a simulation clock that is used across simulation.
         //! @returns constant reference to currently running clock.
         virtual const SimulationClock& GetSimulationClock() const = 0;
-
     };
 
     class ROS2BusTraits : public AZ::EBusTraits
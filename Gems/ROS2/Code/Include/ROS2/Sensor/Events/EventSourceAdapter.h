@@ -11,6 +11,7 @@
 #include <ROS2/ROS2Bus.h>
 #include <ROS2/Sensor/Events/SensorEventSource.h>
 #include <ROS2/Sensor/SensorConfiguration.h>
+#include <ROS2/Sensor/SensorSchedulerBus.h>
 
 namespace ROS2
 {
@@ -54,6 +55,9 @@ namespace ROS2
     //! of using directly a class derived from SensorEventSource, when specific working frequency is required. Following this path, user can
     //! still use source event - ROS2::EventSourceAdapter::ConnectToSourceEvent. This template has to be resolved using a class derived from
     //! SensorEventSource specialization.
+    //! When started, the adapter registers with the sensor scheduler (ROS2::SensorSchedulerInterface), which staggers publications of
+    //! all adapters across physics steps. If the scheduler is unavailable, or scheduling is disabled for an adapter whose adapted event
+    //! does not publish (ROS2::EventSourceAdapter::SetSchedulingEnabled), the adapter counts source events on its own.
     //! @see ROS2::SensorEventSource
     template<class EventSourceT>
     class EventSourceAdapter
@@ -111,6 +115,12 @@ namespace ROS2
                 });
             m_eventSource.ConnectToSourceEvent(m_sourceAdaptingEventHandler);
             m_eventSource.Start();
+
+            UnregisterFromScheduler();
+            if (auto* sensorScheduler = SensorSchedulerInterface::Get(); sensorScheduler && m_schedulingEnabled)
+            {
+                m_scheduleId = sensorScheduler->RegisterSensor(m_adaptedFrequency);
+            }
         }
 
         //! Stops event source adapter - stops event source and disconnects internal adapted event handler from source event. If it will be
@@ -120,6 +130,7 @@ namespace ROS2
         {
             m_eventSource.Stop();
             m_sourceAdaptingEventHandler.Disconnect();
+            UnregisterFromScheduler();
         }
 
         //! Sets adapter working frequency. By design, adapter will not work correctly, if this frequency will be greater than used event
@@ -131,6 +142,23 @@ namespace ROS2
         void SetFrequency(float adaptedFrequency)
         {
             m_adaptedFrequency = adaptedFrequency;
+            if (auto* sensorScheduler = SensorSchedulerInterface::Get(); sensorScheduler && m_scheduleId != InvalidSensorScheduleId)
+            {
+                sensorScheduler->SetSensorFrequency(m_scheduleId, m_adaptedFrequency);
+            }
+        }
+
+        //! Sets whether the adapter registers with the sensor scheduler on start. Scheduling should be disabled when the adapted event
+        //! does not publish (e.g. publishing is disabled, or the sensor publishes on its own), so that the scheduler neither reserves
+        //! physics steps for the adapter nor counts its events as publications. Enabling scheduling takes effect on the next start.
+        //! @param schedulingEnabled Whether the adapter should be scheduled.
+        void SetSchedulingEnabled(bool schedulingEnabled)
+        {
+            m_schedulingEnabled = schedulingEnabled;
+            if (!m_schedulingEnabled)
+            {
+                UnregisterFromScheduler();
+            }
         }
 
         //! Connects given event handler to source event (ROS2::SensorEventSource). That event is signalled regardless of adapted frequency
@@ -153,7 +181,16 @@ namespace ROS2
         }
 
     private:
-        //! Uses:
+        void UnregisterFromScheduler()
+        {
+            if (auto* sensorScheduler = SensorSchedulerInterface::Get(); sensorScheduler && m_scheduleId != InvalidSensorScheduleId)
+            {
+                sensorScheduler->UnregisterSensor(m_scheduleId);
+            }
+            m_scheduleId = InvalidSensorScheduleId;
+        }
+
+        //! Uses the sensor scheduler, when the adapter is registered with it. Otherwise uses:
         //!  - internal tick counter,
         //!  - last delta time of event source and
         //!  - frequency set for adapter
@@ -163,6 +200,17 @@ namespace ROS2
         //! @return Whether it is time to signal adapted event.
         [[nodiscard]] bool IsPublicationDeadline(float sourceDeltaTime)
         {
+            if (m_scheduleId != InvalidSensorScheduleId)
+            {
+                auto* sensorScheduler = SensorSchedulerInterface::Get();
+                if (sensorScheduler && sensorScheduler->IsSensorRegistered(m_scheduleId))
+                {
+                    return sensorScheduler->IsPublicationDeadline(m_scheduleId);
+                }
+                // The scheduler was deactivated or destroyed while the adapter was running, fall back to its own counter.
+                m_scheduleId = InvalidSensorScheduleId;
+            }
+
             if (--m_tickCounter > 0)
             {
                 return false;
@@ -186,6 +234,8 @@ namespace ROS2
         float m_adaptedFrequency{ 30.0f }; ///< Adapted frequency value.
         float m_adaptedDeltaTime{ 0.0f }; ///< Accumulator for calculating adapted delta time.
         int m_tickCounter{ 0 }; ///< Internal counter for controlling adapter frequency.
+        SensorScheduleId m_scheduleId{ InvalidSensorScheduleId }; ///< Identifier of the adapter in the sensor scheduler.
+        bool m_schedulingEnabled{ true }; ///< Whether the adapter registers with the sensor scheduler on start.
     };
 
     AZ_TYPE_INFO_TEMPLATE(EventSourceAdapter, "{DC8BB5F7-8E0E-42A1-BD82-5FCD9D31B9DD}", AZ_TYPE_INFO_CLASS)
@@ -77,12 +77,16 @@ namespace ROS2
         //! @param sensorFrequency Sensor working frequency.
         //! @param adaptedCallback Adapted event callback - called with sensor working frequency.
         //! @param sourceCallback Source event callback - called with event source frequency.
+        //! @param adaptedCallbackPublishes Whether the adapted event callback publishes sensor data. Only publishing sensors, with
+        //! publishing enabled in their configuration, are staggered by the sensor scheduler (ROS2::SensorSchedulerInterface).
         void StartSensor(
             float sensorFrequency,
             typename EventSourceT::AdaptedCallbackType adaptedCallback,
-            typename EventSourceT::SourceCallbackType sourceCallback = nullptr)
+            typename EventSourceT::SourceCallbackType sourceCallback = nullptr,
+            bool adaptedCallbackPublishes = true)
         {
             m_eventSourceAdapter.SetFrequency(sensorFrequency);
+            m_eventSourceAdapter.SetSchedulingEnabled(adaptedCallbackPublishes && m_sensorConfiguration.m_publishingEnabled);
 
             m_adaptedEventHandler.Disconnect();
             m_adaptedEventHandler = decltype(m_adaptedEventHandler)(adaptedCallback);
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+
+namespace ROS2
+{
+    //! Identifier of a sensor registered with the sensor scheduler.
+    using SensorScheduleId = AZ::u64;
+    //! Identifier returned when a sensor could not be scheduled.
+    static constexpr SensorScheduleId InvalidSensorScheduleId = 0;
+
+    //! Sensor publication load measured by the sensor scheduler over a window of physics steps.
+    struct SensorLoadStatistics
+    {
+        AZ::u64 m_stepCount = 0; ///< Number of physics steps in the window.
+        AZ::u64 m_publicationCount = 0; ///< Number of sensor publications in the window.
+        AZ::u32 m_maxPublicationsPerStep = 0; ///< Highest number of publications within a single physics step.
+        float m_meanPublicationsPerStep = 0.0f; ///< Average number of publications per physics step.
+        AZ::u32 m_scheduledSensorCount = 0; ///< Number of sensors scheduled at the end of the window.
+    };
+
+    //! Interface of the scene-wide sensor scheduler.
+    //! Sensors publishing at a configured frequency register with the scheduler, which counts physics steps and assigns each sensor a
+    //! phase offset, so that sensors with the same or related frequencies publish on different physics steps instead of all at once.
+    //! ROS2::EventSourceAdapter registers with the scheduler automatically.
+    class SensorSchedulerRequests
+    {
+    public:
+        AZ_RTTI(SensorSchedulerRequests, "{6d2f8a41-93c7-4e5b-a0d8-1b7e4c9f3a62}");
+
+        //! Registers a sensor and assigns it the least loaded phase offset for its frequency.
+        //! @param frequency Publication frequency in Hz. Frequencies higher than the physics step rate are limited to it.
+        //! @return Identifier of the registered sensor, or InvalidSensorScheduleId if the scheduler cannot run (e.g. no physics scene).
+        virtual SensorScheduleId RegisterSensor(float frequency) = 0;
+
+        //! Unregisters a sensor.
+        //! @param sensorId Identifier of a previously registered sensor.
+        virtual void UnregisterSensor(SensorScheduleId sensorId) = 0;
+
+        //! Changes the frequency of a registered sensor and assigns it a new phase offset.
+        //! @param sensorId Identifier of a previously registered sensor.
+        //! @param frequency Publication frequency in Hz.
+        virtual void SetSensorFrequency(SensorScheduleId sensorId, float frequency) = 0;
+
+        //! Checks whether the sensor is registered. A sensor stops being registered when the scheduler is deactivated, e.g. with its
+        //! physics scene, in which case the sensor has to time its publications by itself.
+        //! @param sensorId Identifier of a previously registered sensor.
+        //! @return Whether the sensor is registered with the scheduler.
+        virtual bool IsSensorRegistered(SensorScheduleId sensorId) const = 0;
+
+        //! Checks whether the sensor should publish now and, if so, counts the publication towards the current physics step load.
+        //! Once it returns true, it returns false until the next scheduled physics step of the sensor.
+        //! @param sensorId Identifier of a previously registered sensor.
+        //! @return Whether it is time for the sensor to publish, always false for sensors that are not registered.
+        virtual bool IsPublicationDeadline(SensorScheduleId sensorId) = 0;
+
+        //! Returns sensor publication load measured over the last complete window of physics steps.
+        virtual SensorLoadStatistics GetLoadStatistics() const = 0;
+
+    protected:
+        ~SensorSchedulerRequests() = default;
+    };
+
+    using SensorSchedulerInterface = AZ::Interface<SensorSchedulerRequests>;
+} // namespace ROS2
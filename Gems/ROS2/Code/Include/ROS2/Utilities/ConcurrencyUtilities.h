@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/base.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace ROS2::ConcurrencyUtilities
+{
+    //! Call task for every index in [0, count) on the job system, running at most maxConcurrency tasks at a time.
+    //! Jobs take indices one at a time, so tasks of uneven cost are balanced between jobs. If at most one job would be
+    //! started, all tasks run on the calling thread. Blocks until all tasks are finished.
+    //! @param count number of indices to call the task for.
+    //! @param maxConcurrency maximum number of jobs calling the task at the same time.
+    //! @param task callable taking the index, safe to call concurrently for different indices.
+    template<typename Task>
+    void ForEachConcurrently(size_t count, AZ::u64 maxConcurrency, const Task& task)
+    {
+        const size_t jobCount = AZStd::min(count, aznumeric_cast<size_t>(maxConcurrency));
+        if (jobCount <= 1)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                task(i);
+            }
+            return;
+        }
+
+        AZStd::atomic<size_t> nextIndex{ 0 };
+        AZ::JobCompletion jobCompletion;
+        for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+        {
+            AZ::Job* job = AZ::CreateJobFunction(
+                [&task, &nextIndex, count]()
+                {
+                    for (size_t i = nextIndex++; i < count; i = nextIndex++)
+                    {
+                        task(i);
+                    }
+                },
+                true);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+    //! Call task for every index in [0, count) on the job system, running at most one task per hardware thread at a time.
+    //! @see ForEachConcurrently(size_t, AZ::u64, const Task&)
+    template<typename Task>
+    void ForEachConcurrently(size_t count, const Task& task)
+    {
+        ForEachConcurrently(count, AZStd::max(AZStd::thread::hardware_concurrency(), 1u), task);
+    }
+} // namespace ROS2::ConcurrencyUtilities
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "CameraFrameWorkerPool.h"
+
+#include <AzCore/std/algorithm.h>
+
+namespace ROS2
+{
+    CameraFrameWorkerPool::CameraFrameWorkerPool()
+    {
+        if (!CameraFrameWorkerPoolInterface::Get())
+        {
+            CameraFrameWorkerPoolInterface::Register(this);
+        }
+    }
+
+    CameraFrameWorkerPool::~CameraFrameWorkerPool()
+    {
+        Deactivate();
+        if (CameraFrameWorkerPoolInterface::Get() == this)
+        {
+            CameraFrameWorkerPoolInterface::Unregister(this);
+        }
+    }
+
+    void CameraFrameWorkerPool::Activate(AZ::u32 workerCount, AZ::u32 queueDepth)
+    {
+        Deactivate();
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_queueDepth = AZStd::max<size_t>(queueDepth, 1);
+            m_isActive = true;
+        }
+
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "ROS2 camera frame worker";
+        workerCount = AZStd::max<AZ::u32>(workerCount, 1);
+        m_workers.reserve(workerCount);
+        for (AZ::u32 i = 0; i < workerCount; ++i)
+        {
+            m_workers.emplace_back(
+                threadDesc,
+                [this]()
+                {
+                    ProcessFrames();
+                });
+        }
+    }
+
+    void CameraFrameWorkerPool::Deactivate()
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_isActive = false;
+            m_cameraQueues.clear();
+            m_readyCameras.clear();
+        }
+        m_frameAvailable.notify_all();
+
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+        m_workers.clear();
+    }
+
+    void CameraFrameWorkerPool::Submit(AZ::EntityId cameraEntityId, FrameTask task)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (m_isActive)
+            {
+                auto& cameraQueue = m_cameraQueues[cameraEntityId];
+                if (cameraQueue.m_pendingFrames.size() >= m_queueDepth)
+                {
+                    // Drop the oldest frame of this camera; the newest one is the most relevant to subscribers.
+                    cameraQueue.m_pendingFrames.pop_front();
+                    m_droppedFrameCount.fetch_add(1, AZStd::memory_order_relaxed);
+                }
+                cameraQueue.m_pendingFrames.push_back(AZStd::move(task));
+                if (cameraQueue.m_pendingFrames.size() == 1 && !cameraQueue.m_isProcessed)
+                {
+                    m_readyCameras.push_back(cameraEntityId);
+                    m_frameAvailable.notify_one();
+                }
+                return;
+            }
+        }
+        task();
+    }
+
+    AZ::u64 CameraFrameWorkerPool::GetDroppedFrameCount() const
+    {
+        return m_droppedFrameCount.load(AZStd::memory_order_relaxed);
+    }
+
+    void CameraFrameWorkerPool::ProcessFrames()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+        while (true)
+        {
+            m_frameAvailable.wait(
+                lock,
+                [this]()
+                {
+                    return !m_isActive || !m_readyCameras.empty();
+                });
+            if (!m_isActive)
+            {
+                return;
+            }
+
+            // Only one worker at a time takes frames of a camera, so that they are published in order.
+            const AZ::EntityId cameraEntityId = m_readyCameras.front();
+            m_readyCameras.pop_front();
+            auto& cameraQueue = m_cameraQueues[cameraEntityId];
+            FrameTask task = AZStd::move(cameraQueue.m_pendingFrames.front());
+            cameraQueue.m_pendingFrames.pop_front();
+            cameraQueue.m_isProcessed = true;
+
+            lock.unlock();
+            task();
+            lock.lock();
+
+            if (!m_isActive)
+            {
+                return;
+            }
+            auto cameraQueueIt = m_cameraQueues.find(cameraEntityId);
+            cameraQueueIt->second.m_isProcessed = false;
+            if (cameraQueueIt->second.m_pendingFrames.empty())
+            {
+                m_cameraQueues.erase(cameraQueueIt);
+            }
+            else
+            {
+                // Frames of other cameras waiting in the meantime are picked up first.
+                m_readyCameras.push_back(cameraEntityId);
+                m_frameAvailable.notify_one();
+            }
+        }
+    }
+} // namespace ROS2
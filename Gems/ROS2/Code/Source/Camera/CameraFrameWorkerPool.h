@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/conditional_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace ROS2
+{
+    //! Bounded pool of worker threads processing completed camera frames.
+    //! Camera sensors submit their readback results to the pool instead of post-processing and publishing them on the thread
+    //! that Atom invokes readback callbacks on, so that expensive post-processing does not stall rendering.
+    //! Frames of each camera are kept in a separate queue and processed one at a time, in the order of submission, so that a camera
+    //! publishes its frames in timestamp order regardless of the number of workers. Each queue is bounded: when it is full, the
+    //! oldest pending frame of that camera is dropped in favor of the new one, so that a busy camera cannot evict frames of others.
+    class CameraFrameWorkerPool
+    {
+    public:
+        AZ_RTTI(CameraFrameWorkerPool, "{9d3a6f1c-5b7e-4e28-a0c4-2f8e6b1d7c35}");
+
+        //! Task processing a single camera frame.
+        using FrameTask = AZStd::function<void()>;
+
+        static constexpr AZ::u32 DefaultWorkerCount = 2;
+        static constexpr AZ::u32 DefaultQueueDepth = 8;
+
+        CameraFrameWorkerPool();
+        virtual ~CameraFrameWorkerPool();
+
+        //! Starts worker threads.
+        //! @param workerCount Number of worker threads. At least one worker is started.
+        //! @param queueDepth Maximum number of frames of a single camera waiting for a worker. At least one frame is kept.
+        void Activate(AZ::u32 workerCount = DefaultWorkerCount, AZ::u32 queueDepth = DefaultQueueDepth);
+        //! Stops worker threads. Frames still waiting in the queue are discarded.
+        void Deactivate();
+
+        //! Queues a frame for processing. If the pool is not active, the task is run on the calling thread.
+        //! @param cameraEntityId Entity of the camera that produced the frame. Frames of the same camera are processed in order.
+        //! @param task Task processing the frame. It should hold everything it needs, including the readback data.
+        void Submit(AZ::EntityId cameraEntityId, FrameTask task);
+
+        //! Get the count of frames dropped because the queue of their camera was full.
+        AZ::u64 GetDroppedFrameCount() const;
+
+    private:
+        //! Frames of a single camera waiting for a worker.
+        struct CameraQueue
+        {
+            AZStd::deque<FrameTask> m_pendingFrames;
+            bool m_isProcessed = false; //!< True while a worker runs a frame of this camera.
+        };
+
+        void ProcessFrames();
+
+        AZStd::vector<AZStd::thread> m_workers;
+        AZStd::unordered_map<AZ::EntityId, CameraQueue> m_cameraQueues;
+        //! Cameras with pending frames and no frame being processed, in the order they are to be picked up by workers.
+        AZStd::deque<AZ::EntityId> m_readyCameras;
+        AZStd::mutex m_mutex;
+        AZStd::condition_variable m_frameAvailable;
+        size_t m_queueDepth = DefaultQueueDepth;
+        bool m_isActive = false;
+        AZStd::atomic<AZ::u64> m_droppedFrameCount{ 0 };
+    };
+
+    using CameraFrameWorkerPoolInterface = AZ::Interface<CameraFrameWorkerPool>;
+} // namespace ROS2
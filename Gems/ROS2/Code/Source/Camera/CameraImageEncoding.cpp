@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "CameraImageEncoding.h"
+
+#include <AzCore/Math/Simd.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+namespace ROS2
+{
+    namespace Internal
+    {
+        constexpr AZ::u8 QoiOpIndex = 0x00;
+        constexpr AZ::u8 QoiOpDiff = 0x40;
+        constexpr AZ::u8 QoiOpLuma = 0x80;
+        constexpr AZ::u8 QoiOpRun = 0xc0;
+        constexpr AZ::u8 QoiOpRgb = 0xfe;
+        constexpr AZ::u8 QoiOpRgba = 0xff;
+        constexpr AZ::u8 QoiMaxRun = 62;
+        constexpr size_t QoiHeaderSize = 14;
+        constexpr AZStd::array<AZ::u8, 8> QoiEndMarker = { 0, 0, 0, 0, 0, 0, 0, 1 };
+
+        struct QoiPixel
+        {
+            AZ::u8 r = 0;
+            AZ::u8 g = 0;
+            AZ::u8 b = 0;
+            AZ::u8 a = 255;
+
+            bool operator==(const QoiPixel& other) const
+            {
+                return r == other.r && g == other.g && b == other.b && a == other.a;
+            }
+        };
+
+        AZ::u8 QoiHash(const QoiPixel& pixel)
+        {
+            return (pixel.r * 3 + pixel.g * 5 + pixel.b * 7 + pixel.a * 11) % 64;
+        }
+
+        void WriteBigEndian(AZ::u8*& out, AZ::u32 value)
+        {
+            *out++ = static_cast<AZ::u8>(value >> 24);
+            *out++ = static_cast<AZ::u8>(value >> 16);
+            *out++ = static_cast<AZ::u8>(value >> 8);
+            *out++ = static_cast<AZ::u8>(value);
+        }
+    } // namespace Internal
+
+    void CameraImageEncoding::EncodeQoi(
+        const AZ::u8* pixels, AZ::u32 width, AZ::u32 height, AZ::u8 channels, std::vector<AZ::u8>& encoded)
+    {
+        using namespace Internal;
+        AZ_Assert(channels == 3 || channels == 4, "QOI supports 3 or 4 channels.");
+        const size_t pixelCount = static_cast<size_t>(width) * height;
+
+        // Worst case: every pixel takes an RGBA op (tag byte and 4 channels).
+        encoded.resize(QoiHeaderSize + pixelCount * 5 + QoiEndMarker.size());
+        AZ::u8* out = encoded.data();
+
+        *out++ = 'q';
+        *out++ = 'o';
+        *out++ = 'i';
+        *out++ = 'f';
+        WriteBigEndian(out, width);
+        WriteBigEndian(out, height);
+        *out++ = channels;
+        *out++ = 1; // All channels linear.
+
+        AZStd::array<QoiPixel, 64> index{};
+        for (auto& indexed : index)
+        {
+            indexed.a = 0;
+        }
+        QoiPixel previous;
+        AZ::u8 run = 0;
+
+        for (size_t i = 0; i < pixelCount; ++i)
+        {
+            const AZ::u8* source = pixels + i * 4;
+            const QoiPixel pixel{ source[0], source[1], source[2], source[3] };
+
+            if (pixel == previous)
+            {
+                ++run;
+                if (run == QoiMaxRun || i + 1 == pixelCount)
+                {
+                    *out++ = QoiOpRun | static_cast<AZ::u8>(run - 1);
+                    run = 0;
+                }
+                continue;
+            }
+
+            if (run > 0)
+            {
+                *out++ = QoiOpRun | static_cast<AZ::u8>(run - 1);
+                run = 0;
+            }
+
+            const AZ::u8 hash = QoiHash(pixel);
+            if (index[hash] == pixel)
+            {
+                *out++ = QoiOpIndex | hash;
+            }
+            else
+            {
+                index[hash] = pixel;
+                if (pixel.a == previous.a)
+                {
+                    const AZ::s8 dr = static_cast<AZ::s8>(pixel.r - previous.r);
+                    const AZ::s8 dg = static_cast<AZ::s8>(pixel.g - previous.g);
+                    const AZ::s8 db = static_cast<AZ::s8>(pixel.b - previous.b);
+                    const AZ::s8 drg = static_cast<AZ::s8>(dr - dg);
+                    const AZ::s8 dbg = static_cast<AZ::s8>(db - dg);
+
+                    if (dr > -3 && dr < 2 && dg > -3 && dg < 2 && db > -3 && db < 2)
+                    {
+                        *out++ = QoiOpDiff | static_cast<AZ::u8>((dr + 2) << 4 | (dg + 2) << 2 | (db + 2));
+                    }
+                    else if (drg > -9 && drg < 8 && dg > -33 && dg < 32 && dbg > -9 && dbg < 8)
+                    {
+                        *out++ = QoiOpLuma | static_cast<AZ::u8>(dg + 32);
+                        *out++ = static_cast<AZ::u8>((drg + 8) << 4 | (dbg + 8));
+                    }
+                    else
+                    {
+                        *out++ = QoiOpRgb;
+                        *out++ = pixel.r;
+                        *out++ = pixel.g;
+                        *out++ = pixel.b;
+                    }
+                }
+                else
+                {
+                    *out++ = QoiOpRgba;
+                    *out++ = pixel.r;
+                    *out++ = pixel.g;
+                    *out++ = pixel.b;
+                    *out++ = pixel.a;
+                }
+            }
+            previous = pixel;
+        }
+
+        out = AZStd::copy(QoiEndMarker.begin(), QoiEndMarker.end(), out);
+        // Shrinking keeps the capacity, so the buffer does not reallocate for following frames.
+        encoded.resize(out - encoded.data());
+    }
+
+    void CameraImageEncoding::QuantizeDepth(const float* depth, size_t count, AZ::u16* quantized)
+    {
+        using AZ::Simd::Vec4;
+        const Vec4::FloatType scale = Vec4::Splat(DepthScale);
+        const Vec4::FloatType minDepth = Vec4::ZeroFloat();
+        const Vec4::FloatType maxDepth = Vec4::Splat(static_cast<float>(AZStd::numeric_limits<AZ::u16>::max()));
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const Vec4::FloatType millimeters = Vec4::Min(Vec4::Max(Vec4::Mul(Vec4::LoadUnaligned(depth + i), scale), minDepth), maxDepth);
+            alignas(16) AZ::s32 values[4];
+            Vec4::StoreAligned(values, Vec4::ConvertToIntNearest(millimeters));
+            quantized[i] = static_cast<AZ::u16>(values[0]);
+            quantized[i + 1] = static_cast<AZ::u16>(values[1]);
+            quantized[i + 2] = static_cast<AZ::u16>(values[2]);
+            quantized[i + 3] = static_cast<AZ::u16>(values[3]);
+        }
+
+        for (; i < count; ++i)
+        {
+            const float millimeters = AZStd::clamp(depth[i] * DepthScale, 0.0f, static_cast<float>(AZStd::numeric_limits<AZ::u16>::max()));
+            quantized[i] = static_cast<AZ::u16>(millimeters + 0.5f);
+        }
+    }
+
+    bool CameraImageEncoding::EncodeImage(
+        const sensor_msgs::msg::Image& image, sensor_msgs::msg::CompressedImage& compressedImage, DepthEncodingBuffers& depthBuffers)
+    {
+        const size_t pixelCount = static_cast<size_t>(image.width) * image.height;
+        if (image.encoding == "rgba8" && image.data.size() >= pixelCount * 4)
+        {
+            compressedImage.header = image.header;
+            compressedImage.format = ColorFormat;
+            EncodeQoi(image.data.data(), image.width, image.height, 4, compressedImage.data);
+            return true;
+        }
+
+        if (image.encoding == "32FC1" && image.data.size() >= pixelCount * sizeof(float))
+        {
+            auto& depthMillimeters = depthBuffers.m_depthMillimeters;
+            auto& depthPixels = depthBuffers.m_depthPixels;
+            depthMillimeters.resize_no_construct(pixelCount);
+            depthPixels.resize_no_construct(pixelCount * 4);
+
+            QuantizeDepth(reinterpret_cast<const float*>(image.data.data()), pixelCount, depthMillimeters.data());
+            for (size_t i = 0; i < pixelCount; ++i)
+            {
+                AZ::u8* pixel = depthPixels.data() + i * 4;
+                pixel[0] = static_cast<AZ::u8>(depthMillimeters[i] >> 8);
+                pixel[1] = static_cast<AZ::u8>(depthMillimeters[i]);
+                pixel[2] = 0;
+                pixel[3] = 255;
+            }
+
+            compressedImage.header = image.header;
+            compressedImage.format = DepthFormat;
+            EncodeQoi(depthPixels.data(), image.width, image.height, 3, compressedImage.data);
+            return true;
+        }
+
+        return false;
+    }
+} // namespace ROS2
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <sensor_msgs/msg/compressed_image.hpp>
+#include <sensor_msgs/msg/image.hpp>
+
+#include <vector>
+
+namespace ROS2
+{
+    //! Lossless encoding of camera images for compressed image topics.
+    //! Images are encoded with the QOI ("Quite OK Image") format, which needs no external libraries and encodes
+    //! an order of magnitude faster than PNG at a comparable ratio on rendered images.
+    //! Since image_transport plugins do not decode QOI, encoded images are published on the "qoi" subtopic of the image topic.
+    namespace CameraImageEncoding
+    {
+        //! Format of compressed color images (rgba8 images encoded as 4-channel QOI).
+        inline constexpr char ColorFormat[] = "rgba8; qoi";
+        //! Format of compressed depth images. Depth in millimeters is stored as 16UC1; the high byte of each pixel
+        //! is kept in the red channel and the low byte in the green channel of a 3-channel QOI image.
+        inline constexpr char DepthFormat[] = "16UC1; qoi";
+
+        //! Scale of depth quantization, from meters to millimeters.
+        inline constexpr float DepthScale = 1000.0f;
+
+        //! Scratch buffers of depth encoding. They keep their capacity between frames, so that encoding does not allocate.
+        struct DepthEncodingBuffers
+        {
+            AZStd::vector<AZ::u16> m_depthMillimeters;
+            AZStd::vector<AZ::u8> m_depthPixels;
+        };
+
+        //! Compressed image message along with the buffers used to encode it, recycled between frames of a camera.
+        struct CompressedImageFrame
+        {
+            sensor_msgs::msg::CompressedImage m_message;
+            DepthEncodingBuffers m_depthBuffers;
+        };
+
+        //! Encode pixels as a QOI image.
+        //! @param pixels Pixels with 4 bytes per pixel (RGBA), in rows without padding.
+        //! @param width Image width in pixels.
+        //! @param height Image height in pixels.
+        //! @param channels Channel count stored in the header, 3 (RGB) or 4 (RGBA). Alpha is still encoded if it changes.
+        //! @param encoded Buffer that receives the encoded image. Its capacity is reused between calls.
+        void EncodeQoi(const AZ::u8* pixels, AZ::u32 width, AZ::u32 height, AZ::u8 channels, std::vector<AZ::u8>& encoded);
+
+        //! Quantize depth in meters to 16-bit depth in millimeters, processing several pixels at once with SIMD instructions.
+        //! Depth outside of the representable range is clamped to [0, 65535] millimeters.
+        //! @param depth Depth values in meters.
+        //! @param count Count of depth values.
+        //! @param quantized Buffer of at least count values that receives quantized depth.
+        void QuantizeDepth(const float* depth, size_t count, AZ::u16* quantized);
+
+        //! Encode an image message as a compressed image message.
+        //! Supported encodings are rgba8 (color) and 32FC1 (depth in meters).
+        //! @param image Image to encode.
+        //! @param compressedImage Message that receives the header, format and encoded data.
+        //! @param depthBuffers Scratch buffers used to encode depth images.
+        //! @return Whether the encoding of the image is supported.
+        bool EncodeImage(
+            const sensor_msgs::msg::Image& image, sensor_msgs::msg::CompressedImage& compressedImage, DepthEncodingBuffers& depthBuffers);
+    } // namespace CameraImageEncoding
+} // namespace ROS2
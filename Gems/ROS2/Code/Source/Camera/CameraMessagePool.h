@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <sensor_msgs/msg/image.hpp>
+
+namespace ROS2
+{
+    //! Pool of messages recycled between frames of a single camera sensor.
+    //! Released messages keep the capacity of their data buffers, so once the pool is warmed up,
+    //! filling a message with a frame of the same size performs no heap allocation.
+    //! Acquire and Release are thread-safe, since readback callbacks of different channels may run concurrently.
+    //! @tparam Message type of recycled messages, or of structures holding a message along with buffers used to fill it.
+    template<typename Message>
+    class CameraMessagePool
+    {
+    public:
+        using MessagePtr = AZStd::unique_ptr<Message>;
+
+        static constexpr size_t DefaultMaxPooledMessages = 4;
+
+        //! @param maxPooledMessages maximum number of idle messages kept for reuse. Messages released above it are freed.
+        explicit CameraMessagePool(size_t maxPooledMessages = DefaultMaxPooledMessages)
+            : m_maxPooledMessages(maxPooledMessages)
+        {
+            m_pooledMessages.reserve(m_maxPooledMessages);
+        }
+
+        //! Take a message from the pool, or allocate a new one if the pool is empty.
+        //! @return message with contents of a previous frame (if any), which are meant to be overwritten.
+        MessagePtr Acquire()
+        {
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                if (!m_pooledMessages.empty())
+                {
+                    MessagePtr message = AZStd::move(m_pooledMessages.back());
+                    m_pooledMessages.pop_back();
+                    return message;
+                }
+            }
+            return AZStd::make_unique<Message>();
+        }
+
+        //! Return a message to the pool once it is published.
+        //! @param message message previously obtained with Acquire.
+        void Release(MessagePtr message)
+        {
+            if (!message)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (m_pooledMessages.size() < m_maxPooledMessages)
+            {
+                m_pooledMessages.push_back(AZStd::move(message));
+            }
+        }
+
+        //! Get the count of idle messages waiting for reuse.
+        size_t GetPooledMessageCount() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return m_pooledMessages.size();
+        }
+
+    private:
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<MessagePtr> m_pooledMessages;
+        size_t m_maxPooledMessages;
+    };
+
+    //! Pool of image messages, recycled between frames of a camera sensor.
+    using CameraImageMessagePool = CameraMessagePool<sensor_msgs::msg::Image>;
+} // namespace ROS2
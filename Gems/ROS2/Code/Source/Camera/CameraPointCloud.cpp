@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "CameraPointCloud.h"
+#include "CameraUtilities.h"
+
+#include <AzCore/Math/Simd.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace ROS2
+{
+    namespace Internal
+    {
+        void AddPointField(sensor_msgs::msg::PointCloud2& message, const char* name, AZ::u32 offset)
+        {
+            sensor_msgs::msg::PointField field;
+            field.name = name;
+            field.offset = offset;
+            field.datatype = sensor_msgs::msg::PointField::FLOAT32;
+            field.count = 1;
+            message.fields.push_back(field);
+        }
+
+        //! Write a point, with its color packed as in PCL (0x00RRGGBB stored in the bits of a float) if the cloud has colors.
+        void WritePoint(AZ::u8* point, float x, float y, float z, const AZ::u8* color)
+        {
+            const float coordinates[3] = { x, y, z };
+            memcpy(point, coordinates, sizeof(coordinates));
+            if (color)
+            {
+                const AZ::u32 rgb = AZ::u32(color[0]) << 16 | AZ::u32(color[1]) << 8 | AZ::u32(color[2]);
+                memcpy(point + sizeof(coordinates), &rgb, sizeof(rgb));
+            }
+        }
+    } // namespace Internal
+
+    CameraPointCloud::PixelRays CameraPointCloud::ComputePixelRays(int width, int height, float verticalFieldOfViewDeg)
+    {
+        const AZ::Matrix3x3 intrinsics = CameraUtils::MakeCameraIntrinsics(width, height, verticalFieldOfViewDeg);
+        const float focalLengthX = intrinsics.GetElement(0, 0);
+        const float focalLengthY = intrinsics.GetElement(1, 1);
+        const float principalPointX = intrinsics.GetElement(0, 2);
+        const float principalPointY = intrinsics.GetElement(1, 2);
+
+        PixelRays rays;
+        rays.m_width = aznumeric_cast<AZ::u32>(width);
+        rays.m_height = aznumeric_cast<AZ::u32>(height);
+        rays.m_x.resize_no_construct(static_cast<size_t>(width) * height);
+        rays.m_y.resize_no_construct(static_cast<size_t>(width) * height);
+        for (int v = 0; v < height; ++v)
+        {
+            const float rayY = (static_cast<float>(v) - principalPointY) / focalLengthY;
+            for (int u = 0; u < width; ++u)
+            {
+                const size_t pixel = static_cast<size_t>(v) * width + u;
+                rays.m_x[pixel] = (static_cast<float>(u) - principalPointX) / focalLengthX;
+                rays.m_y[pixel] = rayY;
+            }
+        }
+        return rays;
+    }
+
+    AZStd::shared_ptr<const CameraPointCloud::PixelRays> CameraPointCloud::GetCachedPixelRays(
+        PixelRaysCache& cache, int width, int height, float verticalFieldOfViewDeg)
+    {
+        return cache.GetOrCreate(
+            { width, height, verticalFieldOfViewDeg },
+            [=]()
+            {
+                return AZStd::make_shared<const PixelRays>(ComputePixelRays(width, height, verticalFieldOfViewDeg));
+            });
+    }
+
+    void CameraPointCloud::FillPointCloud(
+        const PixelRays& rays,
+        const float* depth,
+        const AZ::u8* colors,
+        float maxDepth,
+        const std_msgs::msg::Header& header,
+        sensor_msgs::msg::PointCloud2& message)
+    {
+        using AZ::Simd::Vec4;
+        const AZ::u32 pointStep = colors ? 4 * sizeof(float) : 3 * sizeof(float);
+        if (message.point_step != pointStep || message.fields.empty())
+        {
+            message.fields.clear();
+            Internal::AddPointField(message, "x", 0);
+            Internal::AddPointField(message, "y", sizeof(float));
+            Internal::AddPointField(message, "z", 2 * sizeof(float));
+            if (colors)
+            {
+                Internal::AddPointField(message, "rgb", 3 * sizeof(float));
+            }
+            message.point_step = pointStep;
+        }
+
+        const size_t pixelCount = rays.m_x.size();
+        message.header = header;
+        message.width = rays.m_width;
+        message.height = rays.m_height;
+        message.row_step = message.width * pointStep;
+        message.is_bigendian = false;
+        message.is_dense = false;
+        message.data.resize(pixelCount * pointStep);
+
+        const float invalid = AZStd::numeric_limits<float>::quiet_NaN();
+        const float* rayX = rays.m_x.data();
+        const float* rayY = rays.m_y.data();
+        AZ::u8* points = message.data.data();
+
+        // Four pixels are back-projected at once; the structure of arrays layout of rays makes the loads contiguous.
+        size_t i = 0;
+        for (; i + 4 <= pixelCount; i += 4)
+        {
+            const Vec4::FloatType z = Vec4::LoadUnaligned(depth + i);
+            alignas(16) float x[4];
+            alignas(16) float y[4];
+            Vec4::StoreAligned(x, Vec4::Mul(Vec4::LoadUnaligned(rayX + i), z));
+            Vec4::StoreAligned(y, Vec4::Mul(Vec4::LoadUnaligned(rayY + i), z));
+            for (size_t lane = 0; lane < 4; ++lane)
+            {
+                const size_t pixel = i + lane;
+                const bool isValid = depth[pixel] > 0.0f && depth[pixel] < maxDepth;
+                Internal::WritePoint(
+                    points + pixel * pointStep,
+                    isValid ? x[lane] : invalid,
+                    isValid ? y[lane] : invalid,
+                    isValid ? depth[pixel] : invalid,
+                    colors ? colors + pixel * 4 : nullptr);
+            }
+        }
+
+        for (; i < pixelCount; ++i)
+        {
+            const bool isValid = depth[i] > 0.0f && depth[i] < maxDepth;
+            Internal::WritePoint(
+                points + i * pointStep,
+                isValid ? rayX[i] * depth[i] : invalid,
+                isValid ? rayY[i] * depth[i] : invalid,
+                isValid ? depth[i] : invalid,
+                colors ? colors + i * 4 : nullptr);
+        }
+    }
+} // namespace ROS2
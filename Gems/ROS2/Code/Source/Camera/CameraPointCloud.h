@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <Utilities/SharedResourceCache.h>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <std_msgs/msg/header.hpp>
+
+namespace ROS2
+{
+    //! Utilities computing point clouds from camera depth images.
+    namespace CameraPointCloud
+    {
+        //! Rays through pixel centers of a pinhole camera, in the ROS optical frame (x right, y down, z forward).
+        //! Rays are scaled to unit z, so a point is the ray multiplied by its depth. Stored as a structure of arrays, row by row.
+        struct PixelRays
+        {
+            AZ::u32 m_width = 0;
+            AZ::u32 m_height = 0;
+            AZStd::vector<float> m_x;
+            AZStd::vector<float> m_y;
+        };
+
+        //! Camera parameters that pixel rays depend on.
+        struct PixelRaysKey
+        {
+            int m_width = 0;
+            int m_height = 0;
+            float m_verticalFieldOfViewDeg = 0.0f;
+
+            bool operator==(const PixelRaysKey& other) const
+            {
+                return m_width == other.m_width && m_height == other.m_height &&
+                    m_verticalFieldOfViewDeg == other.m_verticalFieldOfViewDeg;
+            }
+        };
+
+        //! Pixel rays shared between cameras, owned by CameraSharedResources.
+        using PixelRaysCache = SharedResourceCache<PixelRaysKey, const PixelRays>;
+
+        //! Compute pixel rays of a camera with intrinsics from CameraUtils::MakeCameraIntrinsics.
+        //! @param width Image width in pixels.
+        //! @param height Image height in pixels.
+        //! @param verticalFieldOfViewDeg Vertical field of view of the camera in degrees.
+        //! @return Rays through each pixel.
+        PixelRays ComputePixelRays(int width, int height, float verticalFieldOfViewDeg);
+
+        //! Get pixel rays for the camera, computing them only if needed.
+        //! Rays are cached and shared between all cameras with the same resolution and field of view,
+        //! for as long as any of them holds the returned pointer.
+        //! @param cache Cache of pixel rays.
+        //! @param width Image width in pixels.
+        //! @param height Image height in pixels.
+        //! @param verticalFieldOfViewDeg Vertical field of view of the camera in degrees.
+        //! @return Shared rays through each pixel.
+        AZStd::shared_ptr<const PixelRays> GetCachedPixelRays(
+            PixelRaysCache& cache, int width, int height, float verticalFieldOfViewDeg);
+
+        //! Fill an organized point cloud message by back-projecting depth, processing several pixels at once with SIMD instructions.
+        //! The cloud has fields x, y, z, and rgb if colors are given. Pixels without a valid depth (not greater than zero or
+        //! not smaller than maxDepth) give NaN points, following the convention of organized point clouds.
+        //! The data buffer of the message is resized in place, so its capacity is reused when the message is filled repeatedly.
+        //! @param rays Pixel rays of the camera.
+        //! @param depth Depth of each pixel along the optical axis in meters.
+        //! @param colors Color of each pixel, 4 bytes (rgba8) per pixel, or nullptr for a cloud without colors.
+        //! @param maxDepth Depth at and beyond which pixels are considered empty (e.g. the far clip distance).
+        //! @param header Header of the message.
+        //! @param message Message to fill.
+        void FillPointCloud(
+            const PixelRays& rays,
+            const float* depth,
+            const AZ::u8* colors,
+            float maxDepth,
+            const std_msgs::msg::Header& header,
+            sensor_msgs::msg::PointCloud2& message);
+    } // namespace CameraPointCloud
+} // namespace ROS2
@@ -101,6 +101,43 @@ namespace ROS2
             const auto cameraInfoPublisherConfigs = GetCameraInfoTopicConfiguration<CameraType>(cameraDescription.m_sensorConfiguration);
             AddPublishersFromConfiguration(cameraDescription.m_cameraNamespace, cameraInfoPublisherConfigs, infoPublishers);
         }
+
+        //! Helper that adds a compressed image publisher next to the image publisher of a channel.
+        //! Following the image_transport convention, images are published on a subtopic named after their transport. QOI is not
+        //! understood by the "compressed" and "compressedDepth" transports, so it is published on the "qoi" subtopic.
+        void AddCompressedImagePublisher(
+            const CameraSensorDescription& cameraDescription,
+            CameraSensorDescription::CameraChannelType channel,
+            const AZStd::string& imageConfigurationKey,
+            AZStd::unordered_map<CameraSensorDescription::CameraChannelType, CameraPublishers::CompressedImagePublisherPtrType>&
+                publishers)
+        {
+            const auto configuration = GetTopicConfiguration(cameraDescription.m_sensorConfiguration, imageConfigurationKey);
+            const AZStd::string fullTopic =
+                ROS2Names::GetNamespacedName(cameraDescription.m_cameraNamespace, configuration.m_topic) + "/qoi";
+            auto ros2Node = ROS2Interface::Get()->GetNode();
+            publishers[channel] = ros2Node->create_publisher<sensor_msgs::msg::CompressedImage>(fullTopic.data(), configuration.GetQoS());
+        }
+
+        //! Helper that adds a publisher of point clouds computed from depth, on the "points" subtopic of the depth image topic.
+        CameraPublishers::PointCloudPublisherPtrType CreatePointCloudPublisher(const CameraSensorDescription& cameraDescription)
+        {
+            const auto configuration = GetTopicConfiguration(cameraDescription.m_sensorConfiguration, CameraConstants::DepthImageConfig);
+            const AZStd::string fullTopic =
+                ROS2Names::GetNamespacedName(cameraDescription.m_cameraNamespace, configuration.m_topic) + "/points";
+            auto ros2Node = ROS2Interface::Get()->GetNode();
+            return ros2Node->create_publisher<sensor_msgs::msg::PointCloud2>(fullTopic.data(), configuration.GetQoS());
+        }
+
+        //! Helper that checks whether a publisher of a channel (if any) has subscribers.
+        template<typename PublisherPtrType>
+        bool HasSubscribers(
+            const AZStd::unordered_map<CameraSensorDescription::CameraChannelType, PublisherPtrType>& publishers,
+            CameraSensorDescription::CameraChannelType type)
+        {
+            auto publisher = publishers.find(type);
+            return publisher != publishers.end() && publisher->second && publisher->second->get_subscription_count() > 0;
+        }
     } // namespace Internal
 
     CameraPublishers::CameraPublishers(const CameraSensorDescription& cameraDescription)
@@ -108,11 +145,31 @@ namespace ROS2
         if (cameraDescription.m_cameraConfiguration.m_colorCamera)
         {
             Internal::AddCameraPublishers<CameraColorSensor>(cameraDescription, m_imagePublishers, m_infoPublishers);
+            if (cameraDescription.m_cameraConfiguration.m_compressedColor)
+            {
+                Internal::AddCompressedImagePublisher(
+                    cameraDescription,
+                    CameraSensorDescription::CameraChannelType::RGB,
+                    CameraConstants::ColorImageConfig,
+                    m_compressedImagePublishers);
+            }
         }
 
         if (cameraDescription.m_cameraConfiguration.m_depthCamera)
         {
             Internal::AddCameraPublishers<CameraDepthSensor>(cameraDescription, m_imagePublishers, m_infoPublishers);
+            if (cameraDescription.m_cameraConfiguration.m_compressedDepth)
+            {
+                Internal::AddCompressedImagePublisher(
+                    cameraDescription,
+                    CameraSensorDescription::CameraChannelType::DEPTH,
+                    CameraConstants::DepthImageConfig,
+                    m_compressedImagePublishers);
+            }
+            if (cameraDescription.m_cameraConfiguration.m_depthPointCloud)
+            {
+                m_pointCloudPublisher = Internal::CreatePointCloudPublisher(cameraDescription);
+            }
         }
     }
 
@@ -127,4 +184,27 @@ namespace ROS2
         AZ_Error("GetInfoPublisher", m_infoPublishers.count(type) == 1, "No publisher of this type, logic error!");
         return m_infoPublishers.at(type);
     }
+
+    CameraPublishers::CompressedImagePublisherPtrType CameraPublishers::GetCompressedImagePublisher(
+        CameraSensorDescription::CameraChannelType type)
+    {
+        auto publisher = m_compressedImagePublishers.find(type);
+        return publisher != m_compressedImagePublishers.end() ? publisher->second : nullptr;
+    }
+
+    CameraPublishers::PointCloudPublisherPtrType CameraPublishers::GetPointCloudPublisher()
+    {
+        return m_pointCloudPublisher;
+    }
+
+    bool CameraPublishers::HasSubscribers(CameraSensorDescription::CameraChannelType type) const
+    {
+        return Internal::HasSubscribers(m_imagePublishers, type) || Internal::HasSubscribers(m_infoPublishers, type) ||
+            Internal::HasSubscribers(m_compressedImagePublishers, type);
+    }
+
+    bool CameraPublishers::HasPointCloudSubscribers() const
+    {
+        return m_pointCloudPublisher && m_pointCloudPublisher->get_subscription_count() > 0;
+    }
 } // namespace ROS2
@@ -13,7 +13,9 @@
 
 #include <rclcpp/publisher.hpp>
 #include <sensor_msgs/msg/camera_info.hpp>
+#include <sensor_msgs/msg/compressed_image.hpp>
 #include <sensor_msgs/msg/image.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
 #include <std_msgs/msg/header.hpp>
 
 namespace ROS2
@@ -26,6 +28,12 @@ namespace ROS2
         //! ROS2 image publisher type.
         using ImagePublisherPtrType = std::shared_ptr<rclcpp::Publisher<sensor_msgs::msg::Image>>;
 
+        //! ROS2 compressed image publisher type.
+        using CompressedImagePublisherPtrType = std::shared_ptr<rclcpp::Publisher<sensor_msgs::msg::CompressedImage>>;
+
+        //! ROS2 point cloud publisher type.
+        using PointCloudPublisherPtrType = std::shared_ptr<rclcpp::Publisher<sensor_msgs::msg::PointCloud2>>;
+
         //! ROS2 camera sensor publisher type.
         using CameraInfoPublisherPtrType = std::shared_ptr<rclcpp::Publisher<sensor_msgs::msg::CameraInfo>>;
 
@@ -33,9 +41,22 @@ namespace ROS2
 
         ImagePublisherPtrType GetImagePublisher(CameraSensorDescription::CameraChannelType type);
         CameraInfoPublisherPtrType GetInfoPublisher(CameraSensorDescription::CameraChannelType type);
+        //! Get the compressed image publisher of a channel.
+        //! @return publisher, or nullptr if compression is not enabled for the channel.
+        CompressedImagePublisherPtrType GetCompressedImagePublisher(CameraSensorDescription::CameraChannelType type);
+        //! Get the publisher of point clouds computed from depth.
+        //! @return publisher, or nullptr if point clouds are not enabled.
+        PointCloudPublisherPtrType GetPointCloudPublisher();
+
+        //! Check whether any image, compressed image or camera info topic of a channel has subscribers.
+        bool HasSubscribers(CameraSensorDescription::CameraChannelType type) const;
+        //! Check whether the point cloud topic has subscribers.
+        bool HasPointCloudSubscribers() const;
 
     private:
         AZStd::unordered_map<CameraSensorDescription::CameraChannelType, ImagePublisherPtrType> m_imagePublishers;
         AZStd::unordered_map<CameraSensorDescription::CameraChannelType, CameraInfoPublisherPtrType> m_infoPublishers;
+        AZStd::unordered_map<CameraSensorDescription::CameraChannelType, CompressedImagePublisherPtrType> m_compressedImagePublishers;
+        PointCloudPublisherPtrType m_pointCloudPublisher;
     };
 } // namespace ROS2
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "CameraRenderPipeline.h"
+
+#include <Atom/Feature/Utils/FrameCaptureBus.h>
+#include <Atom/RPI.Public/Pass/Specific/RenderToTexturePass.h>
+#include <Atom/RPI.Public/RPISystemInterface.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/View.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <PostProcess/PostProcessFeatureProcessor.h>
+
+namespace ROS2
+{
+    AZStd::shared_ptr<CameraRenderPipeline> CameraRenderPipeline::Create(
+        const AZStd::string& pipelineName, const AZStd::string& templateName, AZ::u32 width, AZ::u32 height)
+    {
+        return AZStd::make_shared<CameraRenderPipeline>(pipelineName, templateName, width, height, false);
+    }
+
+    AZStd::shared_ptr<CameraRenderPipeline> CameraRenderPipeline::GetShared(
+        SharedPipelineCache& sharedPipelines,
+        const AZStd::string& rigName,
+        const AZStd::string& templateName,
+        AZ::u32 width,
+        AZ::u32 height)
+    {
+        const AZStd::string pipelineName =
+            AZStd::string::format("%sRigPipeline%s%ux%u", rigName.c_str(), templateName.c_str(), width, height);
+        return sharedPipelines.GetOrCreate(
+            pipelineName,
+            [&]()
+            {
+                return AZStd::make_shared<CameraRenderPipeline>(pipelineName, templateName, width, height, true);
+            });
+    }
+
+    CameraRenderPipeline::CameraRenderPipeline(
+        const AZStd::string& pipelineName, const AZStd::string& templateName, AZ::u32 width, AZ::u32 height, bool isShared)
+        : m_pipelineName(pipelineName)
+        , m_isShared(isShared)
+    {
+        AZ_TracePrintf("CameraRenderPipeline", "Initializing pipeline %s\n", m_pipelineName.c_str());
+
+        const AZ::Name viewName = AZ::Name("MainCamera");
+        m_view = AZ::RPI::View::CreateView(viewName, AZ::RPI::View::UsageCamera);
+        m_scene = AZ::RPI::RPISystemInterface::Get()->GetSceneByName(AZ::Name("Main"));
+
+        AZ::RPI::RenderPipelineDescriptor pipelineDesc;
+        pipelineDesc.m_mainViewTagName = "MainCamera";
+        pipelineDesc.m_name = m_pipelineName;
+        pipelineDesc.m_rootPassTemplate = templateName;
+        pipelineDesc.m_renderSettings.m_multisampleState = AZ::RPI::RPISystemInterface::Get()->GetApplicationMultisampleState();
+        m_pipeline = AZ::RPI::RenderPipeline::CreateRenderPipeline(pipelineDesc);
+        m_pipeline->RemoveFromRenderTick();
+
+        if (auto renderToTexturePass = azrtti_cast<AZ::RPI::RenderToTexturePass*>(m_pipeline->GetRootPass().get()))
+        {
+            renderToTexturePass->ResizeOutput(width, height);
+        }
+
+        m_scene->AddRenderPipeline(m_pipeline);
+
+        m_pipeline->SetDefaultView(m_view);
+        const AZ::RPI::ViewPtr targetView = m_scene->GetDefaultRenderPipeline()->GetDefaultView();
+        if (auto* fp = m_scene->GetFeatureProcessor<AZ::Render::PostProcessFeatureProcessor>())
+        {
+            fp->SetViewAlias(m_view, targetView);
+        }
+
+        if (m_isShared)
+        {
+            AZ::TickBus::Handler::BusConnect();
+        }
+    }
+
+    CameraRenderPipeline::~CameraRenderPipeline()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        m_pendingFrames.clear();
+        if (m_scene)
+        {
+            if (auto* fp = m_scene->GetFeatureProcessor<AZ::Render::PostProcessFeatureProcessor>())
+            {
+                fp->RemoveViewAlias(m_view);
+            }
+            m_scene->RemoveRenderPipeline(m_pipeline->GetId());
+            m_scene = nullptr;
+        }
+        m_pipeline.reset();
+        m_view.reset();
+    }
+
+    void CameraRenderPipeline::RequestFrame(
+        AZ::EntityId cameraId, const AZ::Matrix4x4& viewToClip, const AZ::Transform& cameraPose, AZStd::vector<AttachmentCapture> captures)
+    {
+        FrameRequest request{ cameraId, viewToClip, cameraPose, AZStd::move(captures) };
+        if (!m_isShared)
+        {
+            RenderFrame(request);
+            return;
+        }
+
+        auto pendingFrame = AZStd::find_if(
+            m_pendingFrames.begin(),
+            m_pendingFrames.end(),
+            [cameraId](const FrameRequest& pending)
+            {
+                return pending.m_cameraId == cameraId;
+            });
+        if (pendingFrame != m_pendingFrames.end())
+        {
+            // Keep the camera's place in the queue, but render the most recent pose.
+            *pendingFrame = AZStd::move(request);
+            AZ_Warning(
+                "CameraRenderPipeline",
+                m_skippedFrameCount > 0,
+                "Cameras sharing pipeline %s request frames faster than it renders them (one camera per tick, %zu cameras queued), "
+                "frames are skipped. Lower camera frequencies or remove cameras from the rig.",
+                m_pipelineName.c_str(),
+                m_pendingFrames.size());
+            ++m_skippedFrameCount;
+        }
+        else
+        {
+            m_pendingFrames.push_back(AZStd::move(request));
+        }
+    }
+
+    bool CameraRenderPipeline::IsShared() const
+    {
+        return m_isShared;
+    }
+
+    const AZStd::string& CameraRenderPipeline::GetPipelineName() const
+    {
+        return m_pipelineName;
+    }
+
+    AZ::u64 CameraRenderPipeline::GetSkippedFrameCount() const
+    {
+        return m_skippedFrameCount;
+    }
+
+    void CameraRenderPipeline::RenderFrame(const FrameRequest& request)
+    {
+        m_view->SetViewToClipMatrix(request.m_viewToClip);
+        const AZ::Transform inverse = (request.m_cameraPose * AtomToRos).GetInverse();
+        m_view->SetWorldToViewMatrix(AZ::Matrix4x4::CreateFromQuaternionAndTranslation(inverse.GetRotation(), inverse.GetTranslation()));
+
+        m_pipeline->AddToRenderTickOnce();
+        for (const auto& capture : request.m_captures)
+        {
+            AZ::Render::FrameCaptureOutcome captureOutcome;
+            AZStd::vector<AZStd::string> passHierarchy{ m_pipelineName, capture.m_passName };
+            AZ::Render::FrameCaptureRequestBus::BroadcastResult(
+                captureOutcome,
+                &AZ::Render::FrameCaptureRequestBus::Events::CapturePassAttachmentWithCallback,
+                capture.m_callback,
+                passHierarchy,
+                capture.m_slotName,
+                AZ::RPI::PassAttachmentReadbackOption::Output);
+
+            AZ_Error(
+                "CameraRenderPipeline",
+                captureOutcome.IsSuccess(),
+                "Frame capture initialization failed. %s",
+                captureOutcome.GetError().m_errorMessage.c_str());
+        }
+    }
+
+    void CameraRenderPipeline::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        if (m_pendingFrames.empty())
+        {
+            return;
+        }
+
+        const FrameRequest request = AZStd::move(m_pendingFrames.front());
+        m_pendingFrames.pop_front();
+        RenderFrame(request);
+    }
+} // namespace ROS2
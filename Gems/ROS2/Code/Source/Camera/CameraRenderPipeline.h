@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Base.h>
+#include <Atom/RPI.Public/Pass/AttachmentReadback.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <Utilities/SharedResourceCache.h>
+
+namespace ROS2
+{
+    //! Atom render pipeline used to render camera images, either by a single camera or shared by cameras of a rig.
+    //! A pipeline renders a single view per tick. A shared pipeline therefore queues frame requests of its cameras and renders them
+    //! in turns, one per tick, which trades camera latency for a single pipeline (with its passes and attachments) per rig.
+    //! Cameras of a rig of N cameras get at most 1/N of the tick rate each; a warning is reported when frames are skipped.
+    class CameraRenderPipeline : public AZ::TickBus::Handler
+    {
+    public:
+        //! Registry of shared pipelines by name, owned by CameraSharedResources.
+        using SharedPipelineCache = SharedResourceCache<AZStd::string, CameraRenderPipeline>;
+
+        using ReadbackCallback = AZStd::function<void(const AZ::RPI::AttachmentReadback::ReadbackResult& result)>;
+
+        //! Attachment to read back once a frame is rendered.
+        struct AttachmentCapture
+        {
+            AZStd::string m_passName; //!< Name of the pass, a direct child of the pipeline root pass.
+            AZStd::string m_slotName; //!< Name of the attachment slot of the pass.
+            ReadbackCallback m_callback; //!< Callback called with the read back attachment.
+        };
+
+        //! Create a pipeline used by a single camera.
+        //! @param pipelineName Unique name of the pipeline.
+        //! @param templateName Name of the pipeline root pass template.
+        //! @param width Width of rendered images in pixels.
+        //! @param height Height of rendered images in pixels.
+        static AZStd::shared_ptr<CameraRenderPipeline> Create(
+            const AZStd::string& pipelineName, const AZStd::string& templateName, AZ::u32 width, AZ::u32 height);
+
+        //! Get the pipeline shared by cameras of a rig, creating it if it does not exist yet.
+        //! Cameras of a rig share a pipeline only if they use the same pass template and image size.
+        //! The pipeline is released when the last camera using it releases the returned pointer.
+        //! @param sharedPipelines Registry of shared pipelines.
+        //! @param rigName Name of the camera rig.
+        //! @param templateName Name of the pipeline root pass template.
+        //! @param width Width of rendered images in pixels.
+        //! @param height Height of rendered images in pixels.
+        static AZStd::shared_ptr<CameraRenderPipeline> GetShared(
+            SharedPipelineCache& sharedPipelines,
+            const AZStd::string& rigName, const AZStd::string& templateName, AZ::u32 width, AZ::u32 height);
+
+        CameraRenderPipeline(
+            const AZStd::string& pipelineName, const AZStd::string& templateName, AZ::u32 width, AZ::u32 height, bool isShared);
+        ~CameraRenderPipeline();
+
+        //! Request rendering a frame and reading back attachments of the frame.
+        //! A pipeline of a single camera renders the frame right away; a shared pipeline queues it until it is the camera's turn.
+        //! A camera has at most one queued frame: a newer request replaces the older one, which is counted as skipped.
+        //! @param cameraId Entity of the requesting camera.
+        //! @param viewToClip Camera view to clip space transform matrix.
+        //! @param cameraPose Camera pose in the ROS optical frame convention.
+        //! @param captures Attachments to read back.
+        void RequestFrame(
+            AZ::EntityId cameraId,
+            const AZ::Matrix4x4& viewToClip,
+            const AZ::Transform& cameraPose,
+            AZStd::vector<AttachmentCapture> captures);
+
+        //! Whether the pipeline is shared by cameras of a rig.
+        bool IsShared() const;
+
+        //! Get the name of the pipeline.
+        const AZStd::string& GetPipelineName() const;
+
+        //! Get the count of frames replaced by a newer request before being rendered, i.e. the rig requests frames faster than
+        //! the shared pipeline renders them.
+        AZ::u64 GetSkippedFrameCount() const;
+
+    private:
+        struct FrameRequest
+        {
+            AZ::EntityId m_cameraId;
+            AZ::Matrix4x4 m_viewToClip;
+            AZ::Transform m_cameraPose;
+            AZStd::vector<AttachmentCapture> m_captures;
+        };
+
+        void RenderFrame(const FrameRequest& request);
+
+        // AZ::TickBus::Handler overrides
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        const AZ::Transform AtomToRos{ AZ::Transform::CreateFromQuaternion(
+            AZ::Quaternion::CreateFromMatrix3x3(AZ::Matrix3x3::CreateFromRows({ 1, 0, 0 }, { 0, -1, 0 }, { 0, 0, -1 }))) };
+
+        AZ::RPI::ViewPtr m_view;
+        AZ::RPI::Scene* m_scene = nullptr;
+        AZ::RPI::RenderPipelinePtr m_pipeline;
+        AZStd::string m_pipelineName;
+        bool m_isShared = false;
+        AZStd::deque<FrameRequest> m_pendingFrames;
+        AZ::u64 m_skippedFrameCount = 0;
+    };
+} // namespace ROS2
@@ -6,20 +6,17 @@
  *
  */
 #include "CameraSensor.h"
+#include "CameraFrameWorkerPool.h"
+#include "CameraImageEncoding.h"
+#include "CameraPointCloud.h"
+#include "CameraSharedResources.h"
 #include <ROS2/Camera/CameraPostProcessingRequestBus.h>
 
 #include <Atom/RPI.Public/Base.h>
-#include <Atom/RPI.Public/FeatureProcessorFactory.h>
-#include <Atom/RPI.Public/Pass/PassFactory.h>
-#include <Atom/RPI.Public/Pass/PassSystemInterface.h>
-#include <Atom/RPI.Public/Pass/Specific/RenderToTexturePass.h>
-#include <Atom/RPI.Public/RPISystemInterface.h>
-#include <Atom/RPI.Public/RenderPipeline.h>
-#include <Atom/RPI.Public/Scene.h>
 #include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzFramework/Components/TransformComponent.h>
-#include <AzFramework/Scene/SceneSystemInterface.h>
-#include <PostProcess/PostProcessFeatureProcessor.h>
 
 #include <sensor_msgs/distortion_models.hpp>
 
@@ -48,32 +45,138 @@ namespace ROS2
             { AZ::RHI::Format::R32_FLOAT, sizeof(float) },
         };
 
-        //! Create a CameraImage message from the read-back result and a header.
-        sensor_msgs::msg::Image CreateImageMessageFromReadBackResult(
-            const AZ::EntityId& entityId, const AZ::RPI::AttachmentReadback::ReadbackResult& result, const std_msgs::msg::Header& header)
+        //! Fill an image message with the read-back result and a header.
+        //! The data buffer of the message is resized in place, so its capacity is reused when the message is recycled.
+        void FillImageMessageFromReadBackResult(
+            const AZ::RPI::AttachmentReadback::ReadbackResult& result,
+            const std_msgs::msg::Header& header,
+            sensor_msgs::msg::Image& imageMessage)
         {
             const AZ::RHI::ImageDescriptor& descriptor = result.m_imageDescriptor;
             const auto format = descriptor.m_format;
             AZ_Assert(Internal::FormatMappings.contains(format), "Unknown format in result %u", static_cast<uint32_t>(format));
-            sensor_msgs::msg::Image imageMessage;
             imageMessage.encoding = Internal::FormatMappings.at(format);
             imageMessage.width = descriptor.m_size.m_width;
             imageMessage.height = descriptor.m_size.m_height;
             imageMessage.step = imageMessage.width * Internal::BitDepth.at(format);
-            imageMessage.data =
-                std::vector<uint8_t>(result.m_dataBuffer->data(), result.m_dataBuffer->data() + result.m_dataBuffer->size());
+            imageMessage.data.resize(result.m_dataBuffer->size());
+            memcpy(imageMessage.data.data(), result.m_dataBuffer->data(), result.m_dataBuffer->size());
             imageMessage.header = header;
+        }
+
+        //! Apply post-processing registered for the entity, if it supports the encoding of the image.
+        void ApplyPostProcessing(const AZ::EntityId& entityId, sensor_msgs::msg::Image& imageMessage)
+        {
             bool registeredPostProcessingSupportsEncoding = false;
             CameraPostProcessingRequestBus::EventResult(
                 registeredPostProcessingSupportsEncoding,
                 entityId,
                 &CameraPostProcessingRequests::SupportsFormat,
-                AZStd::string(Internal::FormatMappings.at(format)));
+                AZStd::string(imageMessage.encoding.c_str()));
             if (registeredPostProcessingSupportsEncoding)
             {
                 CameraPostProcessingRequestBus::Event(entityId, &CameraPostProcessingRequests::ApplyPostProcessing, imageMessage);
             }
-            return imageMessage;
+        }
+
+        //! Encode the image and publish it on the compressed image topic, if the channel has one and it has subscribers.
+        //! The message and encoding buffers are recycled through the pool, so that no per-frame buffer is allocated.
+        void PublishCompressedImage(
+            const sensor_msgs::msg::Image& imageMessage,
+            const CameraPublishers::CompressedImagePublisherPtrType& compressedImagePublisher,
+            CameraCompressedImagePool& compressedImagePool)
+        {
+            if (!compressedImagePublisher || compressedImagePublisher->get_subscription_count() == 0)
+            {
+                return;
+            }
+
+            auto compressedImage = compressedImagePool.Acquire();
+            if (CameraImageEncoding::EncodeImage(imageMessage, compressedImage->m_message, compressedImage->m_depthBuffers))
+            {
+                compressedImagePublisher->publish(compressedImage->m_message);
+            }
+            compressedImagePool.Release(AZStd::move(compressedImage));
+        }
+
+        //! Publish the read-back result as an image message, and as a compressed image message if enabled.
+        //! The result is written into a message recycled through the pool, so that no per-frame message is allocated.
+        void PublishReadBackResult(
+            const AZ::EntityId& entityId,
+            const AZ::RPI::AttachmentReadback::ReadbackResult& result,
+            const std_msgs::msg::Header& header,
+            const CameraPublishers::ImagePublisherPtrType& imagePublisher,
+            const CameraPublishers::CompressedImagePublisherPtrType& compressedImagePublisher,
+            CameraImageMessagePool& imageMessagePool,
+            CameraCompressedImagePool& compressedImagePool)
+        {
+            auto imageMessage = imageMessagePool.Acquire();
+            FillImageMessageFromReadBackResult(result, header, *imageMessage);
+            ApplyPostProcessing(entityId, *imageMessage);
+            PublishCompressedImage(*imageMessage, compressedImagePublisher, compressedImagePool);
+            imagePublisher->publish(*imageMessage);
+            imageMessagePool.Release(AZStd::move(imageMessage));
+        }
+
+        //! Process a completed frame on camera frame workers, or on the calling thread if there are none.
+        //! Readback callbacks are invoked on rendering threads, which should not be blocked by post-processing and publishing.
+        void SubmitFrame(const AZ::EntityId& entityId, CameraFrameWorkerPool::FrameTask task)
+        {
+            if (auto* workerPool = CameraFrameWorkerPoolInterface::Get())
+            {
+                workerPool->Submit(entityId, AZStd::move(task));
+            }
+            else
+            {
+                task();
+            }
+        }
+
+        //! Readbacks of a single frame used to compute its point cloud.
+        struct PointCloudFrame
+        {
+            AZStd::mutex m_mutex;
+            bool m_withColor = false;
+            AZStd::optional<AZ::RPI::AttachmentReadback::ReadbackResult> m_depth;
+            AZStd::optional<AZ::RPI::AttachmentReadback::ReadbackResult> m_color;
+        };
+
+        //! Publish the point cloud computed from depth and, optionally, color readbacks of the same frame.
+        void PublishPointCloud(
+            const AZ::RPI::AttachmentReadback::ReadbackResult& depthResult,
+            const AZ::RPI::AttachmentReadback::ReadbackResult* colorResult,
+            const CameraPointCloud::PixelRays& pixelRays,
+            float maxDepth,
+            const std_msgs::msg::Header& header,
+            const CameraPublishers::PointCloudPublisherPtrType& pointCloudPublisher,
+            CameraPointCloudMessagePool& pointCloudPool)
+        {
+            const size_t pixelCount = pixelRays.m_x.size();
+            if (depthResult.m_imageDescriptor.m_format != AZ::RHI::Format::R32_FLOAT ||
+                depthResult.m_dataBuffer->size() < pixelCount * sizeof(float))
+            {
+                AZ_WarningOnce("CameraSensor", false, "Depth readback does not match the camera resolution, skipping the point cloud.");
+                return;
+            }
+            if (colorResult &&
+                (colorResult->m_imageDescriptor.m_format != AZ::RHI::Format::R8G8B8A8_UNORM ||
+                 colorResult->m_dataBuffer->size() < pixelCount * 4))
+            {
+                AZ_WarningOnce("CameraSensor", false, "Color readback does not match the camera resolution, skipping the point cloud.");
+                return;
+            }
+
+            // The message is recycled through the pool, so that its data buffer is not allocated for each frame.
+            auto pointCloud = pointCloudPool.Acquire();
+            CameraPointCloud::FillPointCloud(
+                pixelRays,
+                reinterpret_cast<const float*>(depthResult.m_dataBuffer->data()),
+                colorResult ? colorResult->m_dataBuffer->data() : nullptr,
+                maxDepth,
+                header,
+                *pointCloud);
+            pointCloudPublisher->publish(*pointCloud);
+            pointCloudPool.Release(AZStd::move(pointCloud));
         }
 
         //! Prepare a CameraInfo message from sensor description and a header.
@@ -103,6 +206,13 @@ namespace ROS2
             return cameraInfo;
         }
 
+        //! Pass and attachment slot holding the image rendered by a camera pipeline.
+        constexpr const char* OutputPassName = "CopyToSwapChain";
+        constexpr const char* OutputSlotName = "Output";
+        //! Pass and attachment slot holding linear depth of the frame rendered by a color camera pipeline.
+        constexpr const char* DepthPassName = "DepthPrePass";
+        constexpr const char* DepthSlotName = "DepthLinear";
+
         AZStd::string PipelineNameFromChannelType(CameraSensorDescription::CameraChannelType channel)
         {
             static const AZStd::unordered_map<CameraSensorDescription::CameraChannelType, AZStd::string> channelNameMap = {
@@ -117,124 +227,246 @@ namespace ROS2
         : m_cameraPublishers(cameraSensorDescription)
         , m_cameraSensorDescription(cameraSensorDescription)
         , m_entityId(entityId)
+        , m_imageMessagePool(AZStd::make_shared<CameraImageMessagePool>())
+        , m_compressedImagePool(AZStd::make_shared<CameraCompressedImagePool>())
+        , m_pointCloudPool(AZStd::make_shared<CameraPointCloudMessagePool>())
     {
+        const auto& cameraConfiguration = m_cameraSensorDescription.m_cameraConfiguration;
+        if (cameraConfiguration.m_depthCamera && cameraConfiguration.m_depthPointCloud)
+        {
+            const int width = cameraConfiguration.m_width;
+            const int height = cameraConfiguration.m_height;
+            const float verticalFieldOfViewDeg = cameraConfiguration.m_verticalFieldOfViewDeg;
+            if (auto* sharedResources = CameraSharedResourcesInterface::Get())
+            {
+                m_pixelRays =
+                    CameraPointCloud::GetCachedPixelRays(sharedResources->GetPixelRays(), width, height, verticalFieldOfViewDeg);
+            }
+            else
+            {
+                m_pixelRays = AZStd::make_shared<const CameraPointCloud::PixelRays>(
+                    CameraPointCloud::ComputePixelRays(width, height, verticalFieldOfViewDeg));
+            }
+        }
     }
 
     void CameraSensor::SetupPasses()
     {
         AZ_TracePrintf("CameraSensor", "Initializing pipeline for %s\n", m_cameraSensorDescription.m_cameraName.c_str());
 
-        const AZ::Name viewName = AZ::Name("MainCamera");
-        m_view = AZ::RPI::View::CreateView(viewName, AZ::RPI::View::UsageCamera);
-        m_view->SetViewToClipMatrix(m_cameraSensorDescription.m_viewToClipMatrix);
-        m_scene = AZ::RPI::RPISystemInterface::Get()->GetSceneByName(AZ::Name("Main"));
+        const auto& cameraConfiguration = m_cameraSensorDescription.m_cameraConfiguration;
+        const AZ::u32 width = aznumeric_cast<AZ::u32>(cameraConfiguration.m_width);
+        const AZ::u32 height = aznumeric_cast<AZ::u32>(cameraConfiguration.m_height);
+        if (!cameraConfiguration.m_rigName.empty())
+        {
+            if (auto* sharedResources = CameraSharedResourcesInterface::Get())
+            {
+                m_renderPipeline = CameraRenderPipeline::GetShared(
+                    sharedResources->GetSharedPipelines(), cameraConfiguration.m_rigName, GetPipelineTemplateName(), width, height);
+                return;
+            }
+            AZ_Warning(
+                "CameraSensor",
+                false,
+                "Camera rigs are not available, camera %s uses its own pipeline.",
+                m_cameraSensorDescription.m_cameraName.c_str());
+        }
 
         auto cameraPipelineTypeName = Internal::PipelineNameFromChannelType(GetChannelType());
-
-        m_pipelineName = AZStd::string::format(
+        const AZStd::string pipelineName = AZStd::string::format(
             "%sPipeline%s%s",
             m_cameraSensorDescription.m_cameraName.c_str(),
             cameraPipelineTypeName.c_str(),
             m_entityId.ToString().c_str());
-        AZ::RPI::RenderPipelineDescriptor pipelineDesc;
-        pipelineDesc.m_mainViewTagName = "MainCamera";
-        pipelineDesc.m_name = m_pipelineName;
+        m_renderPipeline = CameraRenderPipeline::Create(pipelineName, GetPipelineTemplateName(), width, height);
+    }
 
-        pipelineDesc.m_rootPassTemplate = GetPipelineTemplateName();
+    CameraSensor::~CameraSensor()
+    {
+        m_renderPipeline.reset();
+    }
 
-        pipelineDesc.m_renderSettings.m_multisampleState = AZ::RPI::RPISystemInterface::Get()->GetApplicationMultisampleState();
-        m_pipeline = AZ::RPI::RenderPipeline::CreateRenderPipeline(pipelineDesc);
-        m_pipeline->RemoveFromRenderTick();
+    void CameraSensor::RequestFrame(const AZ::Transform& cameraPose, AZStd::vector<CameraRenderPipeline::AttachmentCapture> captures)
+    {
+        m_renderPipeline->RequestFrame(m_entityId, m_cameraSensorDescription.m_viewToClipMatrix, cameraPose, AZStd::move(captures));
+    }
 
-        if (auto renderToTexturePass = azrtti_cast<AZ::RPI::RenderToTexturePass*>(m_pipeline->GetRootPass().get()))
+    const CameraSensorDescription& CameraSensor::GetCameraSensorDescription() const
+    {
+        return m_cameraSensorDescription;
+    }
+
+    CameraRenderPipeline::ReadbackCallback CameraSensor::MakePublishingCallback(
+        CameraSensorDescription::CameraChannelType channel, const std_msgs::msg::Header& header)
+    {
+        auto imagePublisher = m_cameraPublishers.GetImagePublisher(channel);
+        auto infoPublisher = m_cameraPublishers.GetInfoPublisher(channel);
+        auto compressedImagePublisher = m_cameraPublishers.GetCompressedImagePublisher(channel);
+        if (!imagePublisher || !infoPublisher)
         {
-            renderToTexturePass->ResizeOutput(
-                m_cameraSensorDescription.m_cameraConfiguration.m_width, m_cameraSensorDescription.m_cameraConfiguration.m_height);
+            AZ_Error("CameraSensor::RequestMessagePublication", false, "Missing publisher for the Camera sensor");
+            return {};
         }
 
-        m_scene->AddRenderPipeline(m_pipeline);
+        auto infoMessage = Internal::CreateCameraInfoMessage(m_cameraSensorDescription, header);
+        return [header,
+                imagePublisher,
+                compressedImagePublisher,
+                infoPublisher,
+                infoMessage,
+                entityId = m_entityId,
+                imageMessagePool = m_imageMessagePool,
+                compressedImagePool = m_compressedImagePool](const AZ::RPI::AttachmentReadback::ReadbackResult& result)
+        {
+            if (result.m_state != AZ::RPI::AttachmentReadback::ReadbackState::Success)
+            {
+                return;
+            }
 
-        m_passHierarchy.push_back(m_pipelineName);
-        m_passHierarchy.push_back("CopyToSwapChain");
+            Internal::SubmitFrame(
+                entityId,
+                [result,
+                 header,
+                 imagePublisher,
+                 compressedImagePublisher,
+                 infoPublisher,
+                 infoMessage,
+                 entityId,
+                 imageMessagePool,
+                 compressedImagePool]()
+                {
+                    Internal::PublishReadBackResult(
+                        entityId, result, header, imagePublisher, compressedImagePublisher, *imageMessagePool, *compressedImagePool);
+                    infoPublisher->publish(infoMessage);
+                });
+        };
+    }
 
-        m_pipeline->SetDefaultView(m_view);
-        const AZ::RPI::ViewPtr targetView = m_scene->GetDefaultRenderPipeline()->GetDefaultView();
-        if (auto* fp = m_scene->GetFeatureProcessor<AZ::Render::PostProcessFeatureProcessor>())
+    void CameraSensor::AddPointCloudPublication(
+        const std_msgs::msg::Header& header,
+        CameraRenderPipeline::ReadbackCallback& depthCallback,
+        CameraRenderPipeline::ReadbackCallback* colorCallback)
+    {
+        auto pointCloudPublisher = m_cameraPublishers.GetPointCloudPublisher();
+        if (!pointCloudPublisher || !IsPointCloudWatched())
         {
-            fp->SetViewAlias(m_view, targetView);
+            return;
         }
-    }
 
-    CameraSensor::~CameraSensor()
-    {
-        if (m_scene)
+        auto frame = AZStd::make_shared<Internal::PointCloudFrame>();
+        frame->m_withColor = colorCallback != nullptr;
+        auto onReadback = [frame,
+                           header,
+                           entityId = m_entityId,
+                           pointCloudPublisher,
+                           pointCloudPool = m_pointCloudPool,
+                           pixelRays = m_pixelRays,
+                           maxDepth = m_cameraSensorDescription.m_cameraConfiguration.m_farClipDistance](
+                              bool isDepth, const AZ::RPI::AttachmentReadback::ReadbackResult& result)
         {
-            if (auto* fp = m_scene->GetFeatureProcessor<AZ::Render::PostProcessFeatureProcessor>())
+            if (result.m_state != AZ::RPI::AttachmentReadback::ReadbackState::Success)
             {
-                fp->RemoveViewAlias(m_view);
+                return;
             }
-            m_scene->RemoveRenderPipeline(m_pipeline->GetId());
-            m_scene = nullptr;
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(frame->m_mutex);
+                (isDepth ? frame->m_depth : frame->m_color) = result;
+                if (!frame->m_depth || (frame->m_withColor && !frame->m_color))
+                {
+                    return;
+                }
+            }
+
+            // All readbacks of the frame arrived; they are not modified anymore.
+            Internal::SubmitFrame(
+                entityId,
+                [frame, header, pointCloudPublisher, pointCloudPool, pixelRays, maxDepth]()
+                {
+                    Internal::PublishPointCloud(
+                        *frame->m_depth,
+                        frame->m_withColor ? &*frame->m_color : nullptr,
+                        *pixelRays,
+                        maxDepth,
+                        header,
+                        pointCloudPublisher,
+                        *pointCloudPool);
+                });
+        };
+
+        depthCallback = [publishImage = AZStd::move(depthCallback), onReadback](const AZ::RPI::AttachmentReadback::ReadbackResult& result)
+        {
+            publishImage(result);
+            onReadback(true, result);
+        };
+        if (colorCallback)
+        {
+            *colorCallback =
+                [publishImage = AZStd::move(*colorCallback), onReadback](const AZ::RPI::AttachmentReadback::ReadbackResult& result)
+            {
+                publishImage(result);
+                onReadback(false, result);
+            };
         }
-        m_passHierarchy.clear();
-        m_pipeline.reset();
-        m_view.reset();
     }
 
-    void CameraSensor::RequestFrame(
-        const AZ::Transform& cameraPose, AZStd::function<void(const AZ::RPI::AttachmentReadback::ReadbackResult& result)> callback)
+    bool CameraSensor::ShouldReadBackChannel(CameraSensorDescription::CameraChannelType channel, const builtin_interfaces::msg::Time& stamp)
     {
-        const AZ::Transform inverse = (cameraPose * AtomToRos).GetInverse();
-        m_view->SetWorldToViewMatrix(AZ::Matrix4x4::CreateFromQuaternionAndTranslation(inverse.GetRotation(), inverse.GetTranslation()));
-
-        AZ::Render::FrameCaptureOutcome captureOutcome;
-
-        m_pipeline->AddToRenderTickOnce();
-        AZ::Render::FrameCaptureRequestBus::BroadcastResult(
-            captureOutcome,
-            &AZ::Render::FrameCaptureRequestBus::Events::CapturePassAttachmentWithCallback,
-            callback,
-            m_passHierarchy,
-            AZStd::string("Output"),
-            AZ::RPI::PassAttachmentReadbackOption::Output);
-
-        AZ_Error(
-            "CameraSensor",
-            captureOutcome.IsSuccess(),
-            "Frame capture initialization failed. %s",
-            captureOutcome.GetError().m_errorMessage.c_str());
+        // Point clouds are computed from depth, and colored with the color channel of the same frame.
+        const bool isWatched = m_cameraPublishers.HasSubscribers(channel) || IsPointCloudWatched();
+        if (!isWatched)
+        {
+            return false;
+        }
+
+        const auto& cameraConfiguration = m_cameraSensorDescription.m_cameraConfiguration;
+        const float maxRate = channel == CameraSensorDescription::CameraChannelType::RGB ? cameraConfiguration.m_colorMaxRate
+                                                                                          : cameraConfiguration.m_depthMaxRate;
+        double& lastReadbackTime = m_lastReadbackTimes[static_cast<size_t>(channel)];
+        const double time = stamp.sec + stamp.nanosec * 1e-9;
+        if (time < lastReadbackTime)
+        { // Simulation time went back (e.g. the simulation was reset), throttle from the current time on.
+            lastReadbackTime = AZStd::numeric_limits<double>::lowest();
+        }
+        if (maxRate > 0.0f)
+        {
+            // Frequency ticks are not exactly periodic, so a small fraction of the period is tolerated.
+            constexpr double PeriodTolerance = 0.05;
+            const double period = 1.0 / maxRate;
+            if (time - lastReadbackTime < period * (1.0 - PeriodTolerance))
+            {
+                return false;
+            }
+        }
+        lastReadbackTime = time;
+        return true;
     }
 
-    const CameraSensorDescription& CameraSensor::GetCameraSensorDescription() const
+    bool CameraSensor::IsPointCloudWatched() const
     {
-        return m_cameraSensorDescription;
+        return m_pixelRays && m_cameraPublishers.HasPointCloudSubscribers();
     }
 
     void CameraSensor::RequestMessagePublication(const AZ::Transform& cameraPose, const std_msgs::msg::Header& header)
     {
-        auto imagePublisher = m_cameraPublishers.GetImagePublisher(GetChannelType());
-        auto infoPublisher = m_cameraPublishers.GetInfoPublisher(GetChannelType());
-        if (!imagePublisher || !infoPublisher)
+        // Skip rendering and readback altogether when nobody is listening or the channel is throttled.
+        if (!ShouldReadBackChannel(GetChannelType(), header.stamp))
         {
-            AZ_Error("CameraSensor::RequestMessagePublication", false, "Missing publisher for the Camera sensor");
             return;
         }
 
-        auto infoMessage = Internal::CreateCameraInfoMessage(m_cameraSensorDescription, header);
-        RequestFrame(
-            cameraPose,
-            [header, imagePublisher, infoPublisher, infoMessage, entityId = m_entityId](
-                const AZ::RPI::AttachmentReadback::ReadbackResult& result)
-            {
-                if (result.m_state != AZ::RPI::AttachmentReadback::ReadbackState::Success)
-                {
-                    return;
-                }
+        auto callback = MakePublishingCallback(GetChannelType(), header);
+        if (!callback)
+        {
+            return;
+        }
 
-                auto imageMessage = Internal::CreateImageMessageFromReadBackResult(entityId, result, header);
-                imagePublisher->publish(imageMessage);
-                infoPublisher->publish(infoMessage);
-            });
+        if (GetChannelType() == CameraSensorDescription::CameraChannelType::DEPTH)
+        {
+            AddPointCloudPublication(header, callback, nullptr);
+        }
+
+        RequestFrame(cameraPose, { { Internal::OutputPassName, Internal::OutputSlotName, AZStd::move(callback) } });
     }
 
     CameraDepthSensor::CameraDepthSensor(const CameraSensorDescription& cameraSensorDescription, const AZ::EntityId& entityId)
@@ -274,45 +506,54 @@ namespace ROS2
     {
     }
 
-    void CameraRGBDSensor::ReadBackDepth(AZStd::function<void(const AZ::RPI::AttachmentReadback::ReadbackResult& result)> callback)
-    {
-        AZ::Render::FrameCaptureOutcome captureOutcome;
-        AZStd::vector<AZStd::string> passHierarchy{ m_pipelineName, "DepthPrePass" };
-        AZ::Render::FrameCaptureRequestBus::BroadcastResult(
-            captureOutcome,
-            &AZ::Render::FrameCaptureRequestBus::Events::CapturePassAttachmentWithCallback,
-            callback,
-            passHierarchy,
-            AZStd::string("DepthLinear"),
-            AZ::RPI::PassAttachmentReadbackOption::Output);
-    }
-
     void CameraRGBDSensor::RequestMessagePublication(const AZ::Transform& cameraPose, const std_msgs::msg::Header& header)
     {
-        auto imagePublisher = m_cameraPublishers.GetImagePublisher(CameraSensorDescription::CameraChannelType::DEPTH);
-        auto infoPublisher = m_cameraPublishers.GetInfoPublisher(CameraSensorDescription::CameraChannelType::DEPTH);
-        if (!imagePublisher || !infoPublisher)
+        // The frame is rendered only if at least one of the channels has to be read back.
+        const bool readBackColor = ShouldReadBackChannel(CameraSensorDescription::CameraChannelType::RGB, header.stamp);
+        const bool readBackDepth = ShouldReadBackChannel(CameraSensorDescription::CameraChannelType::DEPTH, header.stamp);
+        if (!readBackColor && !readBackDepth)
         {
-            AZ_Error("CameraRGBDSensor::RequestMessagePublication", false, "Missing publisher for the Camera sensor");
             return;
         }
 
-        auto infoMessage = Internal::CreateCameraInfoMessage(m_cameraSensorDescription, header);
-        // Process the Depth part.
-        ReadBackDepth(
-            [header, imagePublisher, infoPublisher, infoMessage, entityId = m_entityId](
-                const AZ::RPI::AttachmentReadback::ReadbackResult& result)
+        CameraRenderPipeline::ReadbackCallback colorCallback;
+        CameraRenderPipeline::ReadbackCallback depthCallback;
+        if (readBackColor)
+        {
+            colorCallback = MakePublishingCallback(CameraSensorDescription::CameraChannelType::RGB, header);
+        }
+        if (readBackDepth)
+        {
+            depthCallback = MakePublishingCallback(CameraSensorDescription::CameraChannelType::DEPTH, header);
+        }
+        if ((readBackColor && !colorCallback) || (readBackDepth && !depthCallback))
+        {
+            return;
+        }
+
+        // Color and depth are read back from the same rendered frame. Point clouds follow the depth rate and are always colored,
+        // so that the layout of the point cloud topic does not change between frames. On frames on which the color image is not
+        // due, color is read back for the point cloud only.
+        if (readBackDepth && IsPointCloudWatched())
+        {
+            if (!readBackColor)
             {
-                if (result.m_state != AZ::RPI::AttachmentReadback::ReadbackState::Success)
+                colorCallback = []([[maybe_unused]] const AZ::RPI::AttachmentReadback::ReadbackResult& result)
                 {
-                    return;
-                }
-                auto imageMessage = Internal::CreateImageMessageFromReadBackResult(entityId, result, header);
-                imagePublisher->publish(imageMessage);
-                infoPublisher->publish(infoMessage);
-            });
+                };
+            }
+            AddPointCloudPublication(header, depthCallback, &colorCallback);
+        }
 
-        // Process the Color part.
-        CameraSensor::RequestMessagePublication(cameraPose, header);
+        AZStd::vector<CameraRenderPipeline::AttachmentCapture> captures;
+        if (colorCallback)
+        {
+            captures.push_back({ Internal::OutputPassName, Internal::OutputSlotName, AZStd::move(colorCallback) });
+        }
+        if (readBackDepth)
+        {
+            captures.push_back({ Internal::DepthPassName, Internal::DepthSlotName, AZStd::move(depthCallback) });
+        }
+        RequestFrame(cameraPose, AZStd::move(captures));
     }
 } // namespace ROS2
@@ -8,9 +8,15 @@
 #pragma once
 
 #include <Atom/Feature/Utils/FrameCaptureBus.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/span.h>
+#include <AzCore/std/limits.h>
 
+#include "CameraImageEncoding.h"
+#include "CameraMessagePool.h"
+#include "CameraPointCloud.h"
 #include "CameraPublishers.h"
+#include "CameraRenderPipeline.h"
 #include <ROS2/ROS2GemUtilities.h>
 
 #include <chrono>
@@ -21,8 +27,13 @@
 
 namespace ROS2
 {
+    //! Pool of compressed image messages and their encoding buffers, recycled between frames of a camera sensor.
+    using CameraCompressedImagePool = CameraMessagePool<CameraImageEncoding::CompressedImageFrame>;
+    //! Pool of point cloud messages, recycled between frames of a camera sensor.
+    using CameraPointCloudMessagePool = CameraMessagePool<sensor_msgs::msg::PointCloud2>;
+
     //! Class to create camera sensor using Atom renderer
-    //! It creates dedicated rendering pipeline for each camera
+    //! It creates dedicated rendering pipeline for each camera, or shares one pipeline between cameras of a rig
     class CameraSensor
     {
     public:
@@ -43,11 +54,6 @@ namespace ROS2
         [[nodiscard]] const CameraSensorDescription& GetCameraSensorDescription() const;
 
     private:
-        AZStd::vector<AZStd::string> m_passHierarchy;
-        AZ::RPI::ViewPtr m_view;
-        AZ::RPI::Scene* m_scene = nullptr;
-        const AZ::Transform AtomToRos{ AZ::Transform::CreateFromQuaternion(
-            AZ::Quaternion::CreateFromMatrix3x3(AZ::Matrix3x3::CreateFromRows({ 1, 0, 0 }, { 0, -1, 0 }, { 0, 0, -1 }))) };
         virtual AZStd::string GetPipelineTemplateName() const = 0; //! Returns name of pass template to use in pipeline
         virtual CameraSensorDescription::CameraChannelType GetChannelType()
             const = 0; //! Type of returned data eg Color, Depth, Optical flow
@@ -56,17 +62,53 @@ namespace ROS2
         CameraSensorDescription m_cameraSensorDescription;
         CameraPublishers m_cameraPublishers;
         AZ::EntityId m_entityId;
-        AZ::RPI::RenderPipelinePtr m_pipeline;
-        AZStd::string m_pipelineName;
+        //! Pipeline rendering frames of the camera, dedicated or shared by the camera rig.
+        AZStd::shared_ptr<CameraRenderPipeline> m_renderPipeline;
+        //! Image messages recycled between frames. Shared with pending readback callbacks, which may outlive the sensor.
+        AZStd::shared_ptr<CameraImageMessagePool> m_imageMessagePool;
+        //! Compressed image messages recycled between frames, shared with pending readback callbacks like m_imageMessagePool.
+        AZStd::shared_ptr<CameraCompressedImagePool> m_compressedImagePool;
+        //! Point cloud messages recycled between frames, shared with pending readback callbacks like m_imageMessagePool.
+        AZStd::shared_ptr<CameraPointCloudMessagePool> m_pointCloudPool;
+        //! Rays through pixels used to compute point clouds from depth. Null if point clouds are disabled.
+        AZStd::shared_ptr<const CameraPointCloud::PixelRays> m_pixelRays;
+        //! Time in seconds of the last readback of each channel, indexed by CameraChannelType.
+        AZStd::array<double, 2> m_lastReadbackTimes = { AZStd::numeric_limits<double>::lowest(), AZStd::numeric_limits<double>::lowest() };
 
         //! Request a frame from the rendering pipeline
         //! @param cameraPose - current camera pose from which the rendering should take place
-        //! @param callback - callback function object that will be called when capture is ready.
-        //!                   It's argument is readback structure containing, among other things, a captured image
-        void RequestFrame(
-            const AZ::Transform& cameraPose, AZStd::function<void(const AZ::RPI::AttachmentReadback::ReadbackResult& result)> callback);
+        //! @param captures - attachments to read back from the rendered frame, with callbacks called when each capture is ready.
+        void RequestFrame(const AZ::Transform& cameraPose, AZStd::vector<CameraRenderPipeline::AttachmentCapture> captures);
 
-        //! Read and setup Atom Passes
+        //! Create a readback callback that publishes the image and camera info of a channel.
+        //! @param channel - channel which publishers are used.
+        //! @param header - header with filled message information (frame, timestamp, seq)
+        //! @return callback, or an empty function if the channel has no publishers.
+        CameraRenderPipeline::ReadbackCallback MakePublishingCallback(
+            CameraSensorDescription::CameraChannelType channel, const std_msgs::msg::Header& header);
+
+        //! Check whether a channel should be read back from the current frame, and record the readback if so.
+        //! A channel is read back only if any of its topics (or the point cloud topic) has subscribers, and no more often than
+        //! its maximum rate. Rendering of the frame can be skipped if no channel is read back.
+        //! @param channel - channel to check.
+        //! @param stamp - timestamp of the frame.
+        //! @return whether the channel should be read back.
+        bool ShouldReadBackChannel(CameraSensorDescription::CameraChannelType channel, const builtin_interfaces::msg::Time& stamp);
+
+        //! Check whether point clouds are enabled and the point cloud topic has subscribers.
+        bool IsPointCloudWatched() const;
+
+        //! Extend readback callbacks of a frame, so that they also publish the point cloud computed from depth, if it is enabled
+        //! and has subscribers. The point cloud is computed once every readback of the frame it needs has arrived.
+        //! @param header - header with filled message information (frame, timestamp, seq)
+        //! @param depthCallback - callback of the depth readback.
+        //! @param colorCallback - callback of the color readback of the same frame, or nullptr for a point cloud without colors.
+        void AddPointCloudPublication(
+            const std_msgs::msg::Header& header,
+            CameraRenderPipeline::ReadbackCallback& depthCallback,
+            CameraRenderPipeline::ReadbackCallback* colorCallback);
+
+        //! Create the rendering pipeline, or join the pipeline shared by the camera rig.
         void SetupPasses();
     };
 
@@ -100,8 +142,5 @@ namespace ROS2
 
         // CameraSensor overrides
         void RequestMessagePublication(const AZ::Transform& cameraPose, const std_msgs::msg::Header& header) override;
-
-    private:
-        void ReadBackDepth(AZStd::function<void(const AZ::RPI::AttachmentReadback::ReadbackResult& result)> callback);
     };
 } // namespace ROS2
@@ -17,14 +17,20 @@ namespace ROS2
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<CameraSensorConfiguration>()
-                ->Version(2)
+                ->Version(6)
                 ->Field("VerticalFieldOfViewDeg", &CameraSensorConfiguration::m_verticalFieldOfViewDeg)
                 ->Field("Width", &CameraSensorConfiguration::m_width)
                 ->Field("Height", &CameraSensorConfiguration::m_height)
                 ->Field("Depth", &CameraSensorConfiguration::m_depthCamera)
                 ->Field("Color", &CameraSensorConfiguration::m_colorCamera)
                 ->Field("ClipNear", &CameraSensorConfiguration::m_nearClipDistance)
-                ->Field("ClipFar", &CameraSensorConfiguration::m_farClipDistance);
+                ->Field("ClipFar", &CameraSensorConfiguration::m_farClipDistance)
+                ->Field("CompressedColor", &CameraSensorConfiguration::m_compressedColor)
+                ->Field("CompressedDepth", &CameraSensorConfiguration::m_compressedDepth)
+                ->Field("DepthPointCloud", &CameraSensorConfiguration::m_depthPointCloud)
+                ->Field("ColorMaxRate", &CameraSensorConfiguration::m_colorMaxRate)
+                ->Field("DepthMaxRate", &CameraSensorConfiguration::m_depthMaxRate)
+                ->Field("RigName", &CameraSensorConfiguration::m_rigName);
 
             if (AZ::EditContext* ec = serializeContext->GetEditContext())
             {
@@ -51,7 +57,43 @@ namespace ROS2
                         AZ::Edit::UIHandlers::Default,
                         &CameraSensorConfiguration::m_farClipDistance,
                         "Far clip distance",
-                        "Maximum distance to detect objects");
+                        "Maximum distance to detect objects")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &CameraSensorConfiguration::m_compressedColor,
+                        "Compressed color image",
+                        "Also publish QOI compressed color images on the 'qoi' subtopic of the color image topic")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &CameraSensorConfiguration::m_compressedDepth,
+                        "Compressed depth image",
+                        "Also publish QOI compressed depth images in millimeters on the 'qoi' subtopic of the depth image topic")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &CameraSensorConfiguration::m_depthPointCloud,
+                        "Depth point cloud",
+                        "Also publish a point cloud computed from depth images on the 'points' subtopic of the depth image topic. "
+                        "Points are colored when the color camera is enabled too and a color image is published with the same "
+                        "frame, otherwise the cloud has no color field.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &CameraSensorConfiguration::m_colorMaxRate,
+                        "Color max rate",
+                        "Maximum rate of color images in Hz, limiting the sensor frequency for this channel. Zero for no limit.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &CameraSensorConfiguration::m_depthMaxRate,
+                        "Depth max rate",
+                        "Maximum rate of depth images (and point clouds) in Hz, limiting the sensor frequency for this channel. "
+                        "Zero for no limit.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &CameraSensorConfiguration::m_rigName,
+                        "Camera rig",
+                        "Cameras with the same rig name, image size and image types share a single render pipeline and are rendered "
+                        "in turns, one camera per frame. Leave empty to render the camera with a dedicated pipeline.");
             }
         }
     }
@@ -31,5 +31,11 @@ namespace ROS2
         bool m_depthCamera = true; //!< Use depth camera?
         float m_nearClipDistance = 0.1f; //!< Near clip distance of the camera.
         float m_farClipDistance = 100.0f; //!< Far clip distance of the camera.
+        bool m_compressedColor = false; //!< Publish color images on a compressed image topic as well?
+        bool m_compressedDepth = false; //!< Publish depth images on a compressed image topic as well?
+        bool m_depthPointCloud = false; //!< Publish a point cloud computed from depth images (colored for color and depth cameras)?
+        float m_colorMaxRate = 0.0f; //!< Maximum rate of color image publication in Hz. Zero to publish at the sensor frequency.
+        float m_depthMaxRate = 0.0f; //!< Maximum rate of depth image publication in Hz. Zero to publish at the sensor frequency.
+        AZStd::string m_rigName; //!< Cameras of the same rig share a render pipeline. Empty for a dedicated pipeline.
     };
 } // namespace ROS2
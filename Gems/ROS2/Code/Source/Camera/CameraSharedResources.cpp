@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "CameraSharedResources.h"
+
+namespace ROS2
+{
+    CameraSharedResources::CameraSharedResources()
+    {
+        if (!CameraSharedResourcesInterface::Get())
+        {
+            CameraSharedResourcesInterface::Register(this);
+        }
+    }
+
+    CameraSharedResources::~CameraSharedResources()
+    {
+        Deactivate();
+        if (CameraSharedResourcesInterface::Get() == this)
+        {
+            CameraSharedResourcesInterface::Unregister(this);
+        }
+    }
+
+    void CameraSharedResources::Deactivate()
+    {
+        m_sharedPipelines.Clear();
+        m_pixelRays.Clear();
+    }
+
+    CameraRenderPipeline::SharedPipelineCache& CameraSharedResources::GetSharedPipelines()
+    {
+        return m_sharedPipelines;
+    }
+
+    CameraPointCloud::PixelRaysCache& CameraSharedResources::GetPixelRays()
+    {
+        return m_pixelRays;
+    }
+} // namespace ROS2
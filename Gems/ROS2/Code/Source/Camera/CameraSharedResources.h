@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include "CameraPointCloud.h"
+#include "CameraRenderPipeline.h"
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+
+namespace ROS2
+{
+    //! Resources shared between camera sensors: render pipelines of camera rigs and pixel rays of depth cameras.
+    //! Resources are held weakly and released with their last camera. The owner (the ROS2 system component) clears them on
+    //! deactivation, so that nothing shared by cameras outlives the system.
+    class CameraSharedResources
+    {
+    public:
+        AZ_RTTI(CameraSharedResources, "{4c1e7b2a-8f35-4d06-9a7e-b5d2c83f1e69}");
+
+        CameraSharedResources();
+        virtual ~CameraSharedResources();
+
+        //! Forget all shared resources. Resources still held by cameras stay valid, but are no longer shared with new cameras.
+        void Deactivate();
+
+        //! Get registry of render pipelines shared by cameras of a rig.
+        CameraRenderPipeline::SharedPipelineCache& GetSharedPipelines();
+
+        //! Get cache of pixel rays shared by cameras with the same resolution and field of view.
+        CameraPointCloud::PixelRaysCache& GetPixelRays();
+
+    private:
+        CameraRenderPipeline::SharedPipelineCache m_sharedPipelines;
+        CameraPointCloud::PixelRaysCache m_pixelRays;
+    };
+
+    using CameraSharedResourcesInterface = AZ::Interface<CameraSharedResources>;
+} // namespace ROS2
@@ -7,16 +7,28 @@
  */
 
 #include <AzCore/Time/ITime.h>
-#include <AzCore/std/algorithm.h>
-#include <AzCore/std/containers/deque.h>
-#include <AzCore/std/containers/vector.h>
-#include <AzCore/std/sort.h>
+#include <AzCore/std/string/conversions.h>
 #include <ROS2/Clock/SimulationClock.h>
 #include <ROS2/ROS2Bus.h>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
 #include <rclcpp/qos.hpp>
 
 namespace ROS2
 {
+    namespace
+    {
+        using DiagnosticsPublisher = rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>;
+        using Microseconds = AZStd::chrono::duration<AZ::s64, AZStd::chrono::microseconds::period>;
+
+        diagnostic_msgs::msg::KeyValue MakeLoopTimeValue(const char* key, AZ::s64 loopTimeMicroseconds)
+        {
+            diagnostic_msgs::msg::KeyValue keyValue;
+            keyValue.key = key;
+            keyValue.value = AZStd::to_string(aznumeric_cast<double>(loopTimeMicroseconds) * 1.0e-3).c_str();
+            return keyValue;
+        }
+    } // namespace
+
     builtin_interfaces::msg::Time SimulationClock::GetROSTimestamp() const
     {
         const auto elapsedTime = GetElapsedTimeMicroseconds();
@@ -42,7 +54,16 @@ namespace ROS2
 
     AZStd::chrono::duration<float, AZStd::chrono::seconds::period> SimulationClock::GetExpectedSimulationLoopTime() const
     {
-        return AZStd::chrono::duration<AZ::s64, AZStd::chrono::microseconds::period>(m_currentMedian);
+        return Microseconds(m_loopTimeP50.load(AZStd::memory_order_relaxed));
+    }
+
+    SimulationClock::LoopTimePercentiles SimulationClock::GetSimulationLoopTimePercentiles() const
+    {
+        LoopTimePercentiles percentiles;
+        percentiles.m_p50 = Microseconds(m_loopTimeP50.load(AZStd::memory_order_relaxed));
+        percentiles.m_p95 = Microseconds(m_loopTimeP95.load(AZStd::memory_order_relaxed));
+        percentiles.m_p99 = Microseconds(m_loopTimeP99.load(AZStd::memory_order_relaxed));
+        return percentiles;
     }
 
     void SimulationClock::Tick()
@@ -64,13 +85,41 @@ namespace ROS2
         m_lastExecutionTime = elapsed;
 
         // statistics on execution time
-        m_frameTimes.push_back(deltaTime);
-        if (m_frameTimes.size() > FramesNumberForStats)
+        m_frameTimes.AddSample(deltaTime);
+        m_loopTimeP50.store(m_frameTimes.GetPercentile(0.50f), AZStd::memory_order_relaxed);
+        m_loopTimeP95.store(m_frameTimes.GetPercentile(0.95f), AZStd::memory_order_relaxed);
+        m_loopTimeP99.store(m_frameTimes.GetPercentile(0.99f), AZStd::memory_order_relaxed);
+
+        PublishDiagnostics(elapsed);
+    }
+
+    void SimulationClock::PublishDiagnostics(AZ::s64 elapsed)
+    {
+        if (elapsed - m_lastDiagnosticsTime < DiagnosticsPeriodMicroseconds)
         {
-            m_frameTimes.pop_front();
+            return;
         }
-        AZStd::vector<AZ::s64> frameTimeSorted{ m_frameTimes.begin(), m_frameTimes.end() };
-        AZStd::sort(frameTimeSorted.begin(), frameTimeSorted.end());
-        m_currentMedian = frameTimeSorted[frameTimeSorted.size() / 2];
+        m_lastDiagnosticsTime = elapsed;
+
+        if (!m_diagnosticsPublisher)
+        { // Lazy construct
+            auto ros2Node = ROS2Interface::Get()->GetNode();
+            m_diagnosticsPublisher =
+                ros2Node->create_publisher<diagnostic_msgs::msg::DiagnosticArray>("/diagnostics", rclcpp::SystemDefaultsQoS());
+        }
+
+        diagnostic_msgs::msg::DiagnosticStatus status;
+        status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+        status.name = "o3de: simulation loop";
+        status.message = "Simulation loop time percentiles [ms]";
+        status.hardware_id = "o3de";
+        status.values.push_back(MakeLoopTimeValue("p50", m_loopTimeP50.load(AZStd::memory_order_relaxed)));
+        status.values.push_back(MakeLoopTimeValue("p95", m_loopTimeP95.load(AZStd::memory_order_relaxed)));
+        status.values.push_back(MakeLoopTimeValue("p99", m_loopTimeP99.load(AZStd::memory_order_relaxed)));
+
+        diagnostic_msgs::msg::DiagnosticArray msg;
+        msg.header.stamp = GetROSTimestamp();
+        msg.status.push_back(AZStd::move(status));
+        std::static_pointer_cast<DiagnosticsPublisher>(m_diagnosticsPublisher)->publish(msg);
     }
 } // namespace ROS2
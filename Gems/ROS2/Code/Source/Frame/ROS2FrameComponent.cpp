@@ -74,64 +74,123 @@ namespace ROS2
 
     void ROS2FrameComponent::Activate()
     {
+        m_transformInterface = Internal::GetEntityTransformInterface(GetEntity());
         m_namespaceConfiguration.PopulateNamespace(IsTopLevel(), GetEntity()->GetName());
+        CacheParentFrame();
 
         if (m_publishTransform)
         {
             AZ_TracePrintf("ROS2FrameComponent", "Setting up %s", GetFrameID().data());
+            StartTransformPublication();
+        }
+        AZ::TransformNotificationBus::Handler::BusConnect(GetEntityId());
+    }
 
-            // The frame will always be dynamic if it's a top entity.
-            if (IsTopLevel())
-            {
-                m_isDynamic = true;
-            }
-            // Otherwise it'll be dynamic when it has joints and it's not a fixed joint.
-            else
-            {
-                const bool hasJoints = Internal::CheckIfEntityHasComponentOfType(
-                    m_entity, AZ::Uuid("{B01FD1D2-1D91-438D-874A-BF5EB7E919A8}")); // Physx::JointComponent;
-                const bool hasFixedJoints = Internal::CheckIfEntityHasComponentOfType(
-                    m_entity, AZ::Uuid("{02E6C633-8F44-4CEE-AE94-DCB06DE36422}")); // Physx::FixedJointComponent
-                const bool hasArticulations = Internal::CheckIfEntityHasComponentOfType(
-                    m_entity, AZ::Uuid("{48751E98-B35F-4A2F-A908-D9CDD5230264}")); // Physx::ArticulationComponent
-                m_isDynamic = (hasJoints && !hasFixedJoints) || hasArticulations;
-            }
+    void ROS2FrameComponent::Deactivate()
+    {
+        AZ::TransformNotificationBus::Handler::BusDisconnect();
+        if (m_publishTransform)
+        {
+            StopTransformPublication();
+        }
+        m_parentTransformInterface = nullptr;
+        m_transformInterface = nullptr;
+    }
+
+    void ROS2FrameComponent::OnParentChanged([[maybe_unused]] AZ::EntityId oldParent, [[maybe_unused]] AZ::EntityId newParent)
+    {
+        // The parent frame and its id are replaced together, so that the published transform stays consistent with its header.
+        if (m_publishTransform)
+        {
+            StopTransformPublication();
+        }
+        m_namespaceConfiguration.PopulateNamespace(IsTopLevel(), GetEntity()->GetName());
+        CacheParentFrame();
+        if (m_publishTransform)
+        {
+            StartTransformPublication();
+        }
+    }
+
+    void ROS2FrameComponent::CacheParentFrame()
+    {
+        m_parentTransformInterface = nullptr;
+        if (const auto* parentFrame = GetParentROS2FrameComponent(); parentFrame != nullptr)
+        {
+            m_parentTransformInterface = Internal::GetEntityTransformInterface(parentFrame->GetEntity());
+            AZ_Assert(m_parentTransformInterface, "No transform interface for an entity with a ROS2Frame component, which requires it!");
+        }
+        m_parentFrameId = GetParentFrameID();
+    }
 
-            AZ_TracePrintf(
-                "ROS2FrameComponent",
-                "Setting up %s transform between parent %s and child %s to be published %s\n",
-                IsDynamic() ? "dynamic" : "static",
-                GetParentFrameID().data(),
-                GetFrameID().data(),
-                IsDynamic() ? "continuously to /tf" : "once to /tf_static");
+    void ROS2FrameComponent::StartTransformPublication()
+    {
+        // The frame will always be dynamic if it's a top entity.
+        if (IsTopLevel())
+        {
+            m_isDynamic = true;
+        }
+        // Otherwise it'll be dynamic when it has joints and it's not a fixed joint.
+        else
+        {
+            const bool hasJoints = Internal::CheckIfEntityHasComponentOfType(
+                m_entity, AZ::Uuid("{B01FD1D2-1D91-438D-874A-BF5EB7E919A8}")); // Physx::JointComponent;
+            const bool hasFixedJoints = Internal::CheckIfEntityHasComponentOfType(
+                m_entity, AZ::Uuid("{02E6C633-8F44-4CEE-AE94-DCB06DE36422}")); // Physx::FixedJointComponent
+            const bool hasArticulations = Internal::CheckIfEntityHasComponentOfType(
+                m_entity, AZ::Uuid("{48751E98-B35F-4A2F-A908-D9CDD5230264}")); // Physx::ArticulationComponent
+            m_isDynamic = (hasJoints && !hasFixedJoints) || hasArticulations;
+        }
+
+        AZ_TracePrintf(
+            "ROS2FrameComponent",
+            "Setting up %s transform between parent %s and child %s to be published %s\n",
+            IsDynamic() ? "dynamic" : "static",
+            m_parentFrameId.data(),
+            GetFrameID().data(),
+            IsDynamic() ? "continuously to /tf" : "once to /tf_static");
 
-            m_ros2Transform = AZStd::make_unique<ROS2Transform>(GetParentFrameID(), GetFrameID(), IsDynamic());
-            if (IsDynamic())
+        if (IsDynamic())
+        {
+            // The transform is computed when published, from the cached parent frame registered along with its id.
+            m_dynamicTransformId = ROS2Interface::Get()->RegisterDynamicTransform(
+                m_parentFrameId,
+                GetFrameID(),
+                [this]()
+                {
+                    return GetCachedFrameTransform();
+                });
+            if (m_dynamicTransformId == ROS2Requests::InvalidDynamicTransformId)
             {
+                m_ros2Transform = AZStd::make_unique<ROS2Transform>(m_parentFrameId, GetFrameID(), IsDynamic());
                 AZ::TickBus::Handler::BusConnect();
             }
-            else
-            {
-                m_ros2Transform->Publish(GetFrameTransform());
-            }
+        }
+        else
+        {
+            m_ros2Transform = AZStd::make_unique<ROS2Transform>(m_parentFrameId, GetFrameID(), IsDynamic());
+            m_ros2Transform->Publish(GetCachedFrameTransform());
         }
     }
 
-    void ROS2FrameComponent::Deactivate()
+    void ROS2FrameComponent::StopTransformPublication()
     {
-        if (m_publishTransform)
+        if (IsDynamic())
         {
-            if (IsDynamic())
+            AZ::TickBus::Handler::BusDisconnect();
+            auto* ros2Interface = ROS2Interface::Get();
+            if (ros2Interface && m_dynamicTransformId != ROS2Requests::InvalidDynamicTransformId)
             {
-                AZ::TickBus::Handler::BusDisconnect();
+                ros2Interface->UnregisterDynamicTransform(m_dynamicTransformId);
             }
-            m_ros2Transform.reset();
+            m_dynamicTransformId = ROS2Requests::InvalidDynamicTransformId;
         }
+        m_ros2Transform.reset();
     }
 
     void ROS2FrameComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
-        m_ros2Transform->Publish(GetFrameTransform());
+        m_ros2Transform->Publish(GetCachedFrameTransform());
     }
 
     AZStd::string ROS2FrameComponent::GetGlobalFrameName() const
@@ -159,8 +218,24 @@ namespace ROS2
         return Internal::GetFirstROS2FrameAncestor(GetEntity());
     }
 
+    AZ::Transform ROS2FrameComponent::GetCachedFrameTransform() const
+    {
+        const auto worldFromThis = m_transformInterface->GetWorldTM();
+        if (m_parentTransformInterface)
+        {
+            const auto ancestorFromWorld = m_parentTransformInterface->GetWorldTM().GetInverse();
+            return ancestorFromWorld * worldFromThis;
+        }
+        return worldFromThis;
+    }
+
     AZ::Transform ROS2FrameComponent::GetFrameTransform() const
     {
+        if (m_transformInterface)
+        {
+            return GetCachedFrameTransform();
+        }
+
         auto* transformInterface = Internal::GetEntityTransformInterface(GetEntity());
         if (const auto* parentFrame = GetParentROS2FrameComponent(); parentFrame != nullptr)
         {
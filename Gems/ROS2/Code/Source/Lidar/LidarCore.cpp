@@ -9,6 +9,8 @@
 #include "LidarCore.h"
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/Scene.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/math.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <Lidar/LidarRegistrarSystemComponent.h>
 #include <ROS2/Frame/ROS2FrameComponent.h>
@@ -17,6 +19,16 @@
 
 namespace ROS2
 {
+    namespace
+    {
+        //! Computes the time elapsed between two ROS 2 timestamps, in seconds.
+        float GetTimeDifference(const builtin_interfaces::msg::Time& from, const builtin_interfaces::msg::Time& to)
+        {
+            const AZ::s64 fromNanoseconds = aznumeric_cast<AZ::s64>(from.sec) * 1000000000 + from.nanosec;
+            const AZ::s64 toNanoseconds = aznumeric_cast<AZ::s64>(to.sec) * 1000000000 + to.nanosec;
+            return aznumeric_cast<float>(toNanoseconds - fromNanoseconds) * 1.0e-9f;
+        }
+    } // namespace
 
     void LidarCore::Reflect(AZ::ReflectContext* context)
     {
@@ -74,7 +86,37 @@ namespace ROS2
                 m_lidarConfiguration.m_lidarParameters.m_noiseParameters.m_distanceNoiseStdDevRisePerMeter);
         }
 
+        m_rollingShutter =
+            m_lidarConfiguration.m_rollingShutter && (m_lidarConfiguration.m_lidarSystemFeatures & LidarSystemFeatures::PartialScans);
+
         RaycastResultFlags requestedFlags = RaycastResultFlags::Ranges | RaycastResultFlags::Points;
+        m_pointsInLocalFrame = m_lidarConfiguration.m_lidarSystemFeatures & LidarSystemFeatures::LocalFramePoints;
+        if (m_pointsInLocalFrame)
+        {
+            requestedFlags |= RaycastResultFlags::LocalFramePoints;
+        }
+
+        if (m_lidarConfiguration.m_lidarSystemFeatures & LidarSystemFeatures::PointFields)
+        {
+            if (m_lidarConfiguration.m_includeIntensity)
+            {
+                requestedFlags |= RaycastResultFlags::Intensity;
+            }
+            if (m_lidarConfiguration.m_includeRing)
+            {
+                requestedFlags |= RaycastResultFlags::Ring;
+                LidarRaycasterRequestBus::Event(
+                    m_lidarRaycasterId,
+                    &LidarRaycasterRequestBus::Events::ConfigureRayRings,
+                    LidarTemplateUtils::PopulateRayRings(m_lidarConfiguration.m_lidarParameters));
+            }
+            // Without rolling shutter all points of a scan are cast at once, so the time field is omitted instead of being all zeros.
+            if (m_lidarConfiguration.m_includeTimeOffset && m_rollingShutter)
+            {
+                requestedFlags |= RaycastResultFlags::TimeOffset;
+            }
+        }
+        m_resultFlags = requestedFlags;
 
         LidarRaycasterRequestBus::Event(m_lidarRaycasterId, &LidarRaycasterRequestBus::Events::ConfigureRaycastResultFlags, requestedFlags);
 
@@ -99,6 +141,17 @@ namespace ROS2
                 &LidarRaycasterRequestBus::Events::ConfigureMaxRangePointAddition,
                 m_lidarConfiguration.m_addPointsAtMax);
         }
+
+        if (m_lidarConfiguration.m_lidarSystemFeatures & LidarSystemFeatures::ParallelDispatch)
+        {
+            LidarRaycasterRequestBus::Event(
+                m_lidarRaycasterId, &LidarRaycasterRequestBus::Events::ConfigureParallelDispatch, m_lidarConfiguration.m_parallelDispatch);
+        }
+
+        m_revolutionPhase = 0.0f;
+        m_nextRay = 0;
+        m_pendingScanResults = {};
+        m_pendingScanSlices.clear();
     }
 
     LidarCore::LidarCore(const AZStd::vector<LidarTemplate::LidarModel>& availableModels)
@@ -111,7 +164,7 @@ namespace ROS2
     {
     }
 
-    void LidarCore::VisualizeResults() const
+    void LidarCore::VisualizeResults()
     {
         if (m_lastScanResults.m_points.empty())
         {
@@ -120,10 +173,23 @@ namespace ROS2
 
         if (m_drawQueue)
         {
+            const AZStd::vector<AZ::Vector3>* worldPoints = &m_lastScanResults.m_points;
+            if (ArePointsInLocalFrame())
+            {
+                AZ::Transform lidarTransform = AZ::Transform::CreateIdentity();
+                AZ::TransformBus::EventResult(lidarTransform, m_entityId, &AZ::TransformBus::Events::GetWorldTM);
+                m_visualizationPoints.resize(m_lastScanResults.m_points.size());
+                for (size_t i = 0; i < m_lastScanResults.m_points.size(); ++i)
+                {
+                    m_visualizationPoints[i] = lidarTransform.TransformPoint(m_lastScanResults.m_points[i]);
+                }
+                worldPoints = &m_visualizationPoints;
+            }
+
             const uint8_t pixelSize = 2;
             AZ::RPI::AuxGeomDraw::AuxGeomDynamicDrawArguments drawArgs;
-            drawArgs.m_verts = m_lastScanResults.m_points.data();
-            drawArgs.m_vertCount = m_lastScanResults.m_points.size();
+            drawArgs.m_verts = worldPoints->data();
+            drawArgs.m_vertCount = worldPoints->size();
             drawArgs.m_colors = &AZ::Colors::Red;
             drawArgs.m_colorCount = 1;
             drawArgs.m_opacityType = AZ::RPI::AuxGeomDraw::OpacityType::Opaque;
@@ -148,6 +214,8 @@ namespace ROS2
 
     void LidarCore::Deinit()
     {
+        StopScheduledRaycasts();
+
         for (auto& [implementation, raycasterId] : m_implementationToRaycasterMap)
         {
             LidarSystemRequestBus::Event(AZ_CRC(implementation), &LidarSystemRequestBus::Events::DestroyLidar, raycasterId);
@@ -156,23 +224,157 @@ namespace ROS2
         m_implementationToRaycasterMap.clear();
     }
 
+    bool LidarCore::StartScheduledRaycasts(float frequency, LidarScheduler::ResultsCallback callback)
+    {
+        if (m_rollingShutter || !m_lidarConfiguration.m_sceneScheduling ||
+            !(m_lidarConfiguration.m_lidarSystemFeatures & LidarSystemFeatures::SceneScheduling))
+        {
+            return false;
+        }
+
+        auto* lidarScheduler = LidarSchedulerInterface::Get();
+        if (!lidarScheduler)
+        {
+            return false;
+        }
+
+        m_isScheduled = lidarScheduler->RegisterLidar(m_lidarRaycasterId, m_entityId, frequency, &m_lastScanResults, AZStd::move(callback));
+        return m_isScheduled;
+    }
+
+    void LidarCore::StopScheduledRaycasts()
+    {
+        if (!m_isScheduled)
+        {
+            return;
+        }
+
+        if (auto* lidarScheduler = LidarSchedulerInterface::Get())
+        {
+            lidarScheduler->UnregisterLidar(m_lidarRaycasterId);
+        }
+        m_isScheduled = false;
+    }
+
+    bool LidarCore::IsRollingShutterEnabled() const
+    {
+        return m_rollingShutter;
+    }
+
+    bool LidarCore::PerformRaycastSlice(float deltaTime, float frequency)
+    {
+        const size_t rayCount = m_lastRotations.size();
+        if (rayCount == 0 || frequency <= 0.0f)
+        {
+            return false;
+        }
+
+        const size_t layerCount = AZStd::max<size_t>(1, m_lidarConfiguration.m_lidarParameters.m_layers);
+        const size_t incrementCount = rayCount / layerCount;
+
+        m_revolutionPhase += deltaTime * frequency;
+        const bool revolutionCompleted = m_revolutionPhase >= 1.0f;
+        // Rays are ordered by horizontal increment, so a slice always covers whole columns of the pattern.
+        const size_t endRay = revolutionCompleted
+            ? rayCount
+            : AZStd::min(rayCount, aznumeric_cast<size_t>(m_revolutionPhase * incrementCount) * layerCount);
+
+        if (endRay > m_nextRay)
+        {
+            AZ::Transform lidarTransform = AZ::Transform::CreateIdentity();
+            AZ::TransformBus::EventResult(lidarTransform, m_entityId, &AZ::TransformBus::Events::GetWorldTM);
+
+            ScanSlice& slice = m_pendingScanSlices.emplace_back();
+            slice.m_firstPoint = m_pendingScanResults.m_points.size();
+            slice.m_timestamp = ROS2Interface::Get()->GetROSTimestamp();
+
+            LidarRaycasterRequestBus::Event(
+                m_lidarRaycasterId,
+                &LidarRaycasterRequestBus::Events::PerformPartialRaycastInto,
+                lidarTransform,
+                m_nextRay,
+                endRay - m_nextRay,
+                m_pendingScanResults);
+
+            auto& points = m_pendingScanResults.m_points;
+            if (!m_pointsInLocalFrame)
+            {
+                // Slice points are expressed in the lidar frame at the pose the slice was cast from.
+                const AZ::Transform inverseLidarTransform = lidarTransform.GetInverse();
+                for (size_t i = slice.m_firstPoint; i < points.size(); ++i)
+                {
+                    points[i] = inverseLidarTransform.TransformPoint(points[i]);
+                }
+            }
+            slice.m_pointCount = points.size() - slice.m_firstPoint;
+
+            auto& timeOffsets = m_pendingScanResults.m_timeOffsets;
+            if (!timeOffsets.empty())
+            {
+                // Time offsets reported by the raycaster are relative to the slice, so they are shifted to the beginning of the scan.
+                const float sliceOffset = GetTimeDifference(m_pendingScanSlices.front().m_timestamp, slice.m_timestamp);
+                for (size_t i = slice.m_firstPoint; i < timeOffsets.size(); ++i)
+                {
+                    timeOffsets[i] += sliceOffset;
+                }
+            }
+            m_nextRay = endRay;
+        }
+
+        if (!revolutionCompleted)
+        {
+            return false;
+        }
+
+        AZStd::swap(m_lastScanResults, m_pendingScanResults);
+        m_pendingScanResults.m_points.clear();
+        m_pendingScanResults.m_ranges.clear();
+        m_pendingScanResults.m_intensities.clear();
+        m_pendingScanResults.m_rings.clear();
+        m_pendingScanResults.m_timeOffsets.clear();
+        AZStd::swap(m_lastScanSlices, m_pendingScanSlices);
+        m_pendingScanSlices.clear();
+        m_nextRay = 0;
+        m_revolutionPhase = AZStd::fmod(m_revolutionPhase, 1.0f);
+        return true;
+    }
+
+    const RaycastResult& LidarCore::GetLastScanResults() const
+    {
+        return m_lastScanResults;
+    }
+
+    const AZStd::vector<LidarCore::ScanSlice>& LidarCore::GetLastScanSlices() const
+    {
+        return m_lastScanSlices;
+    }
+
+    bool LidarCore::ArePointsInLocalFrame() const
+    {
+        return m_pointsInLocalFrame || m_rollingShutter;
+    }
+
+    RaycastResultFlags LidarCore::GetResultFlags() const
+    {
+        return m_resultFlags;
+    }
+
     LidarId LidarCore::GetLidarRaycasterId() const
     {
         return m_lidarRaycasterId;
     }
 
-    RaycastResult LidarCore::PerformRaycast()
+    const RaycastResult& LidarCore::PerformRaycast()
     {
         AZ::Entity* entity = nullptr;
         AZ::ComponentApplicationBus::BroadcastResult(entity, &AZ::ComponentApplicationRequests::FindEntity, m_entityId);
         const auto entityTransform = entity->FindComponent<AzFramework::TransformComponent>();
 
-        LidarRaycasterRequestBus::EventResult(
-            m_lastScanResults, m_lidarRaycasterId, &LidarRaycasterRequestBus::Events::PerformRaycast, entityTransform->GetWorldTM());
+        LidarRaycasterRequestBus::Event(
+            m_lidarRaycasterId, &LidarRaycasterRequestBus::Events::PerformRaycastInto, entityTransform->GetWorldTM(), m_lastScanResults);
         if (m_lastScanResults.m_points.empty())
         {
             AZ_TracePrintf("Lidar Sensor Component", "No results from raycast\n");
-            return RaycastResult();
         }
         return m_lastScanResults;
     }
@@ -13,8 +13,10 @@
 #include <ROS2/Lidar/LidarRegistrarBus.h>
 #include <ROS2/Lidar/LidarSystemBus.h>
 #include <ROS2/Sensor/ROS2SensorComponent.h>
+#include <builtin_interfaces/msg/time.hpp>
 
 #include "LidarRaycaster.h"
+#include "LidarScheduler.h"
 #include "LidarSensorConfiguration.h"
 
 namespace ROS2
@@ -26,6 +28,14 @@ namespace ROS2
         AZ_TYPE_INFO(LidarCore, "{e46126a2-7a86-bb65-367a-416f2cab393c}");
         static void Reflect(AZ::ReflectContext* context);
 
+        //! A part of a rolling shutter scan, cast at a single lidar pose.
+        struct ScanSlice
+        {
+            size_t m_firstPoint = 0; //!< Index of the first point of the slice in the scan results.
+            size_t m_pointCount = 0; //!< Number of points of the slice.
+            builtin_interfaces::msg::Time m_timestamp; //!< Simulation time at which the slice was cast.
+        };
+
         LidarCore(const AZStd::vector<LidarTemplate::LidarModel>& availableModels = {});
         LidarCore(const LidarSensorConfiguration& lidarConfiguration);
         ~LidarCore() = default;
@@ -37,10 +47,44 @@ namespace ROS2
         void Deinit();
 
         //! Perform a raycast.
-        //! @return Results of the raycast.
-        RaycastResult PerformRaycast();
+        //! Results are stored in a buffer owned by this object, which is reused between consecutive raycasts.
+        //! @return Results of the raycast, valid until the next call.
+        const RaycastResult& PerformRaycast();
+        //! Start performing raycasts through the scene-wide LidarScheduler instead of PerformRaycast calls.
+        //! Raycasts are then performed on physics steps together with all other scheduled lidars in the scene.
+        //! @param frequency Frequency of raycasts in Hz.
+        //! @param callback Callback called with results of each raycast.
+        //! @return Whether the lidar was scheduled. It is not when scene scheduling is disabled or not supported by the lidar system.
+        bool StartScheduledRaycasts(float frequency, LidarScheduler::ResultsCallback callback);
+        //! Stop performing raycasts through the scene-wide LidarScheduler.
+        void StopScheduledRaycasts();
+
+        //! Is the lidar configured to spread each scan over consecutive physics steps (rolling shutter)?
+        bool IsRollingShutterEnabled() const;
+        //! Perform the next slice of a rolling shutter scan.
+        //! A slice casts the rays swept by the lidar since the previous slice from the current lidar pose. Its points are expressed in
+        //! the lidar frame at that pose, so motion of the lidar during a revolution distorts the scan just like in a real spinning lidar.
+        //! @param deltaTime Time elapsed since the previous slice in seconds.
+        //! @param frequency Revolution frequency in Hz.
+        //! @return True if the slice completed a revolution, in which case the full scan is available through GetLastScanResults.
+        bool PerformRaycastSlice(float deltaTime, float frequency);
+        //! Get results of the last completed scan.
+        //! @return Results valid until the next scan completes.
+        const RaycastResult& GetLastScanResults() const;
+        //! Get slices of the last completed rolling shutter scan.
+        //! @return Slices in order of casting, valid until the next scan completes.
+        const AZStd::vector<ScanSlice>& GetLastScanSlices() const;
+
         //! Visualize the results of the last performed raycast.
-        void VisualizeResults() const;
+        void VisualizeResults();
+
+        //! Are points of raycast results expressed in the lidar reference frame?
+        //! @return True if points are in the lidar frame, false if they are in the world frame.
+        bool ArePointsInLocalFrame() const;
+
+        //! Get flags of results requested from the raycaster.
+        //! @return Requested flags, including optional per-point channels enabled in the configuration and supported by the lidar system.
+        RaycastResultFlags GetResultFlags() const;
 
         //! Get the raycaster used by this lidar.
         //! @return Used raycaster's id.
@@ -61,7 +105,22 @@ namespace ROS2
 
         AZStd::vector<AZ::Vector3> m_lastRotations;
         RaycastResult m_lastScanResults;
+        //! Points of the last scan transformed to world frame for visualization, used only when results are in the lidar frame.
+        AZStd::vector<AZ::Vector3> m_visualizationPoints;
+        bool m_pointsInLocalFrame = false;
+        RaycastResultFlags m_resultFlags = RaycastResultFlags::Ranges | RaycastResultFlags::Points;
+
+        bool m_rollingShutter = false;
+        //! Fraction of the current revolution swept so far.
+        float m_revolutionPhase = 0.0f;
+        //! Index of the first ray of the next rolling shutter slice.
+        size_t m_nextRay = 0;
+        //! Results of the revolution in progress, swapped with m_lastScanResults when it completes.
+        RaycastResult m_pendingScanResults;
+        AZStd::vector<ScanSlice> m_pendingScanSlices;
+        AZStd::vector<ScanSlice> m_lastScanSlices;
 
         AZ::EntityId m_entityId;
+        bool m_isScheduled = false;
     };
 } // namespace ROS2
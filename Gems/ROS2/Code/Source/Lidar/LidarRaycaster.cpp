@@ -7,8 +7,12 @@
  */
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+#include <AzFramework/Physics/Material/PhysicsMaterialManager.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/Shape.h>
@@ -17,6 +21,13 @@
 
 namespace ROS2
 {
+    namespace
+    {
+        //! Reflectivity of surfaces without a known physics material.
+        constexpr float DefaultReflectivity = 0.5f;
+        constexpr const char* RestitutionPropertyName = "Restitution";
+    } // namespace
+
     static AzPhysics::SceneHandle GetPhysicsSceneFromEntityId(const AZ::EntityId& entityId)
     {
         auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
@@ -32,9 +43,10 @@ namespace ROS2
         return lidarPhysicsSceneHandle;
     }
 
-    LidarRaycaster::LidarRaycaster(LidarId busId, AZ::EntityId sceneEntityId)
+    LidarRaycaster::LidarRaycaster(LidarId busId, AZ::EntityId sceneEntityId, LidarTemplateUtils::RayDirectionsCache* rayDirectionsCache)
         : m_busId{ busId }
         , m_sceneEntityId{ sceneEntityId }
+        , m_rayDirectionsCache{ rayDirectionsCache }
     {
         ROS2::LidarRaycasterRequestBus::Handler::BusConnect(busId);
     }
@@ -47,11 +59,22 @@ namespace ROS2
         , m_minRange{ lidarRaycaster.m_minRange }
         , m_range{ lidarRaycaster.m_range }
         , m_addMaxRangePoints{ lidarRaycaster.m_addMaxRangePoints }
+        , m_parallelDispatch{ lidarRaycaster.m_parallelDispatch }
         , m_rayRotations{ AZStd::move(lidarRaycaster.m_rayRotations) }
+        , m_rayRings{ AZStd::move(lidarRaycaster.m_rayRings) }
         , m_ignoredCollisionLayers{ lidarRaycaster.m_ignoredCollisionLayers }
+        , m_rayDirectionsCache{ lidarRaycaster.m_rayDirectionsCache }
+        , m_localRayDirections{ AZStd::move(lidarRaycaster.m_localRayDirections) }
+        , m_rayDirections{ AZStd::move(lidarRaycaster.m_rayDirections) }
+        , m_requests{ AZStd::move(lidarRaycaster.m_requests) }
+        , m_requestBatches{ AZStd::move(lidarRaycaster.m_requestBatches) }
+        , m_hits{ AZStd::move(lidarRaycaster.m_hits) }
+        , m_requestsDirty{ lidarRaycaster.m_requestsDirty }
+        , m_materialReflectivities{ AZStd::move(lidarRaycaster.m_materialReflectivities) }
     {
         lidarRaycaster.BusDisconnect();
         lidarRaycaster.m_busId = LidarId::CreateNull();
+        lidarRaycaster.m_requestsDirty = true;
 
         ROS2::LidarRaycasterRequestBus::Handler::BusConnect(m_busId);
     }
@@ -65,12 +88,14 @@ namespace ROS2
     {
         ValidateRayOrientations(orientations);
         m_rayRotations = orientations;
+        m_requestsDirty = true;
     }
 
     void LidarRaycaster::ConfigureRayRange(float range)
     {
         ValidateRayRange(range);
         m_range = range;
+        m_requestsDirty = true;
     }
 
     void LidarRaycaster::ConfigureMinimumRayRange(float range)
@@ -83,38 +108,176 @@ namespace ROS2
         m_resultFlags = flags;
     }
 
-    AzPhysics::SceneQueryRequests LidarRaycaster::prepareRequests(
-        const AZ::Transform& lidarTransform, const AZStd::vector<AZ::Vector3>& rayDirections) const
+    void LidarRaycaster::ConfigureRayRings(const AZStd::vector<AZ::u16>& rings)
     {
-        using AzPhysics::SceneQuery::HitFlags;
-        const AZ::Vector3& lidarPosition = lidarTransform.GetTranslation();
+        m_rayRings = rings;
+    }
 
-        AzPhysics::SceneQueryRequests requests;
-        requests.reserve(rayDirections.size());
-        for (const AZ::Vector3& direction : rayDirections)
+    void LidarRaycaster::RebuildRequests()
+    {
+        if (m_rayDirectionsCache)
         {
-            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
-            request->m_start = lidarPosition;
-            request->m_direction = direction;
-            request->m_distance = m_range;
-            request->m_reportMultipleHits = false;
+            m_localRayDirections = LidarTemplateUtils::GetCachedLocalDirections(*m_rayDirectionsCache, m_rayRotations);
+        }
+        else
+        {
+            m_localRayDirections =
+                AZStd::make_shared<const LidarTemplateUtils::RayDirections>(LidarTemplateUtils::RotationsToLocalDirections(m_rayRotations));
+        }
+        m_materialReflectivities.clear();
 
-            request->m_filterCallback = [ignoredCollisionLayers = this->m_ignoredCollisionLayers](
-                                            const AzPhysics::SimulatedBody* simBody, const Physics::Shape* shape)
+        // A single filter is shared by all requests. It holds the ignored layers by a shared pointer,
+        // so that neither the set nor the raycaster itself is captured per request.
+        AzPhysics::SceneQuery::FilterCallback filterCallback;
+        if (!m_ignoredCollisionLayers.empty())
+        {
+            auto ignoredCollisionLayers = AZStd::make_shared<AZStd::unordered_set<AZ::u32>>(m_ignoredCollisionLayers);
+            filterCallback = [ignoredCollisionLayers]([[maybe_unused]] const AzPhysics::SimulatedBody* simBody, const Physics::Shape* shape)
             {
-                if (ignoredCollisionLayers.contains(shape->GetCollisionLayer().GetIndex()))
+                if (ignoredCollisionLayers->contains(shape->GetCollisionLayer().GetIndex()))
                 {
                     return AzPhysics::SceneQuery::QueryHitType::None;
                 }
                 return AzPhysics::SceneQuery::QueryHitType::Block;
             };
+        }
+
+        const size_t rayCount = m_localRayDirections->Size();
+        m_requests.clear();
+        m_requests.reserve(rayCount);
+        for (size_t i = 0; i < rayCount; ++i)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_distance = m_range;
+            request->m_reportMultipleHits = false;
+            request->m_filterCallback = filterCallback;
+            m_requests.emplace_back(AZStd::move(request));
+        }
+
+        m_requestBatches.clear();
+        for (size_t batchBegin = 0; batchBegin < rayCount; batchBegin += ParallelDispatchChunkSize)
+        {
+            const size_t batchEnd = AZStd::min(batchBegin + ParallelDispatchChunkSize, rayCount);
+            m_requestBatches.emplace_back(m_requests.begin() + batchBegin, m_requests.begin() + batchEnd);
+        }
+
+        m_hits.resize(rayCount);
+        m_requestsDirty = false;
+    }
+
+    void LidarRaycaster::UpdateRequests(const AZ::Transform& lidarTransform, size_t begin, size_t end)
+    {
+        const AZ::Vector3& lidarPosition = lidarTransform.GetTranslation();
+        const AZ::Matrix3x3 lidarRotation = AZ::Matrix3x3::CreateFromQuaternion(lidarTransform.GetRotation());
+        LidarTemplateUtils::RotateDirections(*m_localRayDirections, lidarRotation, m_rayDirections, begin, end);
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            auto* request = static_cast<AzPhysics::RayCastRequest*>(m_requests[i].get());
+            request->m_start = lidarPosition;
+            request->m_direction = AZ::Vector3(m_rayDirections.m_x[i], m_rayDirections.m_y[i], m_rayDirections.m_z[i]);
+        }
+    }
+
+    void LidarRaycaster::QueryRays(size_t begin, size_t end)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        while (begin < end)
+        {
+            // Whole batches are submitted as they are, only a partial batch (e.g. a rolling shutter slice) is copied.
+            const size_t batchIndex = begin / ParallelDispatchChunkSize;
+            const size_t batchBegin = batchIndex * ParallelDispatchChunkSize;
+            const AzPhysics::SceneQueryRequests& batch = m_requestBatches[batchIndex];
+            const size_t rangeEnd = AZStd::min(end, batchBegin + batch.size());
+            AzPhysics::SceneQueryHitsList batchHits;
+            if (begin == batchBegin && rangeEnd == batchBegin + batch.size())
+            {
+                batchHits = sceneInterface->QuerySceneBatch(m_sceneHandle, batch);
+            }
+            else
+            {
+                const AzPhysics::SceneQueryRequests partialBatch(m_requests.begin() + begin, m_requests.begin() + rangeEnd);
+                batchHits = sceneInterface->QuerySceneBatch(m_sceneHandle, partialBatch);
+            }
+
+            AZ_Assert(batchHits.size() == rangeEnd - begin, "Number of scene query results does not match the number of requests");
+            for (size_t i = 0; i < batchHits.size(); ++i)
+            {
+                m_hits[begin + i] = AZStd::move(batchHits[i]);
+            }
+            begin = rangeEnd;
+        }
+    }
+
+    void LidarRaycaster::DispatchRays(size_t begin, size_t end)
+    {
+        if (m_parallelDispatch && end - begin > ParallelDispatchChunkSize)
+        {
+            QueryRaysParallel(begin, end);
+        }
+        else
+        {
+            QueryRays(begin, end);
+        }
+    }
 
-            requests.emplace_back(AZStd::move(request));
+    void LidarRaycaster::QueryRaysParallel(size_t begin, size_t end)
+    {
+        // Each job writes only to the hit buffers of its own range of rays, so results stay in ray order.
+        // Scene queries take a shared (read) lock on the physics scene, which allows them to run concurrently.
+        // Chunks are aligned to request batches, so that each job submits at most one scene query batch.
+        AZ::JobCompletion jobCompletion;
+        for (size_t chunkBegin = begin; chunkBegin < end;)
+        {
+            const size_t chunkEnd = AZStd::min((chunkBegin / ParallelDispatchChunkSize + 1) * ParallelDispatchChunkSize, end);
+            AZ::Job* job = AZ::CreateJobFunction(
+                [this, chunkBegin, chunkEnd]()
+                {
+                    QueryRays(chunkBegin, chunkEnd);
+                },
+                true);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+            chunkBegin = chunkEnd;
         }
-        return requests;
+        jobCompletion.StartAndWaitForCompletion();
     }
 
     RaycastResult LidarRaycaster::PerformRaycast(const AZ::Transform& lidarTransform)
+    {
+        RaycastResult results;
+        PerformRaycastInto(lidarTransform, results);
+        return results;
+    }
+
+    void LidarRaycaster::PerformRaycastInto(const AZ::Transform& lidarTransform, RaycastResult& results)
+    {
+        const size_t rayCount = PrepareRaycast(lidarTransform);
+        DispatchRays(0, rayCount);
+        CollectResults(lidarTransform, results);
+    }
+
+    void LidarRaycaster::PerformPartialRaycastInto(
+        const AZ::Transform& lidarTransform, size_t firstRay, size_t rayCount, RaycastResult& results)
+    {
+        PrepareRequests();
+
+        const size_t begin = AZStd::min(firstRay, m_requests.size());
+        const size_t end = AZStd::min(begin + rayCount, m_requests.size());
+        UpdateRequests(lidarTransform, begin, end);
+        DispatchRays(begin, end);
+        AppendResults(lidarTransform, begin, end, results);
+    }
+
+    size_t LidarRaycaster::PrepareRaycast(const AZ::Transform& lidarTransform)
+    {
+        PrepareRequests();
+        UpdateRequests(lidarTransform, 0, m_requests.size());
+
+        return m_requests.size();
+    }
+
+    void LidarRaycaster::PrepareRequests()
     {
         AZ_Assert(!m_rayRotations.empty(), "Ray poses are not configured. Unable to Perform a raycast.");
         AZ_Assert(m_range > 0.0f, "Ray range is not configured. Unable to Perform a raycast.");
@@ -124,30 +287,48 @@ namespace ROS2
             m_sceneHandle = GetPhysicsSceneFromEntityId(m_sceneEntityId);
         }
 
-        const AZStd::vector<AZ::Vector3> rayDirections = LidarTemplateUtils::RotationsToDirections(m_rayRotations, lidarTransform);
-        AzPhysics::SceneQueryRequests requests = prepareRequests(lidarTransform, rayDirections);
+        if (m_requestsDirty)
+        {
+            RebuildRequests();
+        }
+    }
 
-        RaycastResult results;
+    void LidarRaycaster::CollectResults(const AZ::Transform& lidarTransform, RaycastResult& results) const
+    {
         const bool handlePoints = (m_resultFlags & RaycastResultFlags::Points) == RaycastResultFlags::Points;
         const bool handleRanges = (m_resultFlags & RaycastResultFlags::Ranges) == RaycastResultFlags::Ranges;
+        results.m_points.clear();
+        results.m_ranges.clear();
+        results.m_intensities.clear();
+        results.m_rings.clear();
+        results.m_timeOffsets.clear();
         if (handlePoints)
         {
-            results.m_points.reserve(rayDirections.size());
+            results.m_points.reserve(m_requests.size());
         }
         if (handleRanges)
         {
-            results.m_ranges.reserve(rayDirections.size());
+            results.m_ranges.reserve(m_requests.size());
         }
 
-        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
-        auto requestResults = sceneInterface->QuerySceneBatch(m_sceneHandle, requests);
-        AZ_Assert(requestResults.size() == rayDirections.size(), "Request size should be equal to directions size");
-        const auto localTransform = lidarTransform.GetInverse();
+        AppendResults(lidarTransform, 0, m_requests.size(), results);
+    }
+
+    void LidarRaycaster::AppendResults(const AZ::Transform& lidarTransform, size_t begin, size_t end, RaycastResult& results) const
+    {
+        const bool handlePoints = (m_resultFlags & RaycastResultFlags::Points) == RaycastResultFlags::Points;
+        const bool handleRanges = (m_resultFlags & RaycastResultFlags::Ranges) == RaycastResultFlags::Ranges;
+        const bool handleLocalFrame = (m_resultFlags & RaycastResultFlags::LocalFramePoints) == RaycastResultFlags::LocalFramePoints;
+        const bool handleIntensity = (m_resultFlags & RaycastResultFlags::Intensity) == RaycastResultFlags::Intensity;
+        const bool handleRing = (m_resultFlags & RaycastResultFlags::Ring) == RaycastResultFlags::Ring;
+        const bool handleTimeOffset = (m_resultFlags & RaycastResultFlags::TimeOffset) == RaycastResultFlags::TimeOffset;
+        const AZ::Vector3& lidarPosition = lidarTransform.GetTranslation();
+        const float inverseLidarScale = 1.0f / lidarTransform.GetUniformScale();
         const float maxRange = m_addMaxRangePoints ? m_range : AZStd::numeric_limits<float>::infinity();
 
-        for (int i = 0; i < requestResults.size(); i++)
+        for (size_t i = begin; i < end; ++i)
         {
-            const auto& requestResult = requestResults[i];
+            const AzPhysics::SceneQueryHits& requestResult = m_hits[i];
             float hitRange = requestResult ? requestResult.m_hits[0].m_distance : maxRange;
             if (hitRange < m_minRange)
             {
@@ -157,31 +338,107 @@ namespace ROS2
             {
                 results.m_ranges.push_back(hitRange);
             }
-            if (handlePoints)
+
+            const bool isMaxRangePoint = hitRange == maxRange;
+            if (!handlePoints || (!isMaxRangePoint && AZStd::isinf(hitRange)))
             {
-                if (hitRange == maxRange)
-                {
-                    // to properly visualize max points they need to be transformed to local coordinate system before applying maxRange
-                    const AZ::Vector3 maxPoint = lidarTransform.TransformPoint(localTransform.TransformVector(rayDirections[i]) * hitRange);
-                    results.m_points.push_back(maxPoint);
-                }
-                else if (!AZStd::isinf(hitRange))
-                {
-                    // otherwise they are already calculated by PhysX
-                    results.m_points.push_back(requestResult.m_hits[0].m_position);
-                }
+                continue;
+            }
+
+            if (handleLocalFrame)
+            {
+                // Points in the lidar frame are computed from ranges and local ray directions,
+                // which avoids transforming hit positions from world to lidar frame afterwards.
+                const float localRange = hitRange * inverseLidarScale;
+                results.m_points.emplace_back(
+                    m_localRayDirections->m_x[i] * localRange,
+                    m_localRayDirections->m_y[i] * localRange,
+                    m_localRayDirections->m_z[i] * localRange);
+            }
+            else if (isMaxRangePoint)
+            {
+                const auto* request = static_cast<const AzPhysics::RayCastRequest*>(m_requests[i].get());
+                results.m_points.push_back(lidarPosition + request->m_direction * hitRange);
+            }
+            else
+            {
+                // otherwise they are already calculated by PhysX
+                results.m_points.push_back(requestResult.m_hits[0].m_position);
             }
+
+            // Per-point channels are written along with the point, so that they stay aligned with it.
+            if (handleIntensity)
+            {
+                results.m_intensities.push_back(requestResult ? GetHitIntensity(requestResult.m_hits[0], i) : 0.0f);
+            }
+            if (handleRing)
+            {
+                results.m_rings.push_back(i < m_rayRings.size() ? m_rayRings[i] : 0);
+            }
+            if (handleTimeOffset)
+            {
+                // All rays of a single call are cast at the same time.
+                results.m_timeOffsets.push_back(0.0f);
+            }
+        }
+    }
+
+    float LidarRaycaster::GetHitIntensity(const AzPhysics::SceneQueryHit& hit, size_t rayIndex) const
+    {
+        using AzPhysics::SceneQuery::ResultFlags;
+        float reflectivity = DefaultReflectivity;
+        if ((hit.m_resultFlags & ResultFlags::Material) == ResultFlags::Material)
+        {
+            reflectivity = GetMaterialReflectivity(hit.m_physicsMaterialId);
         }
 
-        return results;
+        // Surfaces hit at a grazing angle return less light than those facing the lidar.
+        float incidence = 1.0f;
+        if ((hit.m_resultFlags & ResultFlags::Normal) == ResultFlags::Normal)
+        {
+            const auto* request = static_cast<const AzPhysics::RayCastRequest*>(m_requests[rayIndex].get());
+            incidence = AZStd::abs(hit.m_normal.Dot(request->m_direction));
+        }
+        return reflectivity * incidence;
+    }
+
+    float LidarRaycaster::GetMaterialReflectivity(const Physics::MaterialId& materialId) const
+    {
+        for (const auto& [cachedMaterialId, reflectivity] : m_materialReflectivities)
+        {
+            if (cachedMaterialId == materialId)
+            {
+                return reflectivity;
+            }
+        }
+
+        float reflectivity = DefaultReflectivity;
+        if (auto* materialManager = AZ::Interface<Physics::MaterialManager>::Get())
+        {
+            if (const auto material = materialManager->GetMaterial(materialId))
+            {
+                // Physics materials do not describe optical properties, so restitution serves as a proxy for reflectivity:
+                // hard, bouncy surfaces (metal, concrete) return brighter points than soft ones.
+                reflectivity = AZStd::clamp(material->GetProperty(RestitutionPropertyName).GetValue<float>(), 0.0f, 1.0f);
+            }
+        }
+        m_materialReflectivities.emplace_back(materialId, reflectivity);
+        return reflectivity;
     }
 
     void LidarRaycaster::ConfigureIgnoredCollisionLayers(const AZStd::unordered_set<AZ::u32>& layerIndices)
     {
         m_ignoredCollisionLayers = layerIndices;
+        m_requestsDirty = true;
     }
+
     void LidarRaycaster::ConfigureMaxRangePointAddition(bool addMaxRangePoints)
     {
         m_addMaxRangePoints = addMaxRangePoints;
     }
+
+    void LidarRaycaster::ConfigureParallelDispatch(bool enabled)
+    {
+        m_parallelDispatch = enabled;
+    }
 } // namespace ROS2
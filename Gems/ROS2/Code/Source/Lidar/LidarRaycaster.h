@@ -11,7 +11,9 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzFramework/Physics/Material/PhysicsMaterialId.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <Lidar/LidarTemplateUtils.h>
 #include <ROS2/Lidar/LidarRaycasterBus.h>
 
 namespace ROS2
@@ -19,26 +21,69 @@ namespace ROS2
     class LidarRaycaster : protected LidarRaycasterRequestBus::Handler
     {
     public:
-        LidarRaycaster(LidarId busId, AZ::EntityId sceneEntityId);
+        //! @param busId Id of the lidar.
+        //! @param sceneEntityId Entity from which the rays are sent.
+        //! @param rayDirectionsCache Cache of ray directions shared with other lidars. If null, directions are not shared.
+        LidarRaycaster(
+            LidarId busId, AZ::EntityId sceneEntityId, LidarTemplateUtils::RayDirectionsCache* rayDirectionsCache = nullptr);
         LidarRaycaster(LidarRaycaster&& lidarSystem);
         LidarRaycaster(const LidarRaycaster& lidarSystem) = default;
         ~LidarRaycaster() override;
 
+        //! Prepares pooled requests for a raycast originating from the given pose.
+        //! Rays are then queried with QueryRays, possibly in several ranges processed concurrently, and gathered with CollectResults.
+        //! @param lidarTransform Current transform from global to lidar reference frame.
+        //! @return Number of rays to query.
+        size_t PrepareRaycast(const AZ::Transform& lidarTransform);
+        //! Queries the physics scene for rays in range [begin, end) and stores hits in the matching hit buffers.
+        //! Rays are submitted in scene query batches of at most ParallelDispatchChunkSize rays, aligned to multiples of it.
+        //! Calls for disjoint ranges can run concurrently.
+        void QueryRays(size_t begin, size_t end);
+        //! Gathers results of the last queried rays in the requested form.
+        //! @param lidarTransform Transform that was passed to PrepareRaycast.
+        //! @param results Buffer that receives results of the raycast.
+        void CollectResults(const AZ::Transform& lidarTransform, RaycastResult& results) const;
+
+        //! Number of rays processed by a single job when rays are dispatched in parallel.
+        static constexpr size_t ParallelDispatchChunkSize = 2048;
+
     protected:
         // LidarRaycasterRequestBus overrides
         void ConfigureRayOrientations(const AZStd::vector<AZ::Vector3>& orientations) override;
         void ConfigureRayRange(float range) override;
         void ConfigureMinimumRayRange(float range) override;
         void ConfigureRaycastResultFlags(RaycastResultFlags flags) override;
+        void ConfigureRayRings(const AZStd::vector<AZ::u16>& rings) override;
 
         RaycastResult PerformRaycast(const AZ::Transform& lidarTransform) override;
+        void PerformRaycastInto(const AZ::Transform& lidarTransform, RaycastResult& results) override;
+        void PerformPartialRaycastInto(
+            const AZ::Transform& lidarTransform, size_t firstRay, size_t rayCount, RaycastResult& results) override;
 
         void ConfigureIgnoredCollisionLayers(const AZStd::unordered_set<AZ::u32>& layerIndices) override;
         void ConfigureMaxRangePointAddition(bool addMaxRangePoints) override;
+        void ConfigureParallelDispatch(bool enabled) override;
 
     private:
-        AzPhysics::SceneQueryRequests prepareRequests(
-            const AZ::Transform& lidarTransform, const AZStd::vector<AZ::Vector3>& rayDirections) const;
+        //! Builds the persistent pool of ray cast requests (one per ray) along with the local ray directions.
+        //! This is done only when the ray configuration changes, so that scans do not allocate.
+        void RebuildRequests();
+        //! Acquires the physics scene and rebuilds the request pool if the ray configuration changed.
+        void PrepareRequests();
+        //! Updates start positions and directions of the pooled requests in range [begin, end) in place for the current lidar pose.
+        void UpdateRequests(const AZ::Transform& lidarTransform, size_t begin, size_t end);
+        //! Queries rays in range [begin, end), concurrently when parallel dispatch is enabled and the range is large enough.
+        void DispatchRays(size_t begin, size_t end);
+        //! Splits rays in range [begin, end) into chunks aligned to ParallelDispatchChunkSize and queries them concurrently on the job
+        //! system.
+        void QueryRaysParallel(size_t begin, size_t end);
+        //! Appends results of the last queried rays in range [begin, end) to the results buffer.
+        void AppendResults(const AZ::Transform& lidarTransform, size_t begin, size_t end, RaycastResult& results) const;
+        //! Computes intensity of a hit from reflectivity of the hit material and the angle of incidence of the ray.
+        float GetHitIntensity(const AzPhysics::SceneQueryHit& hit, size_t rayIndex) const;
+        //! Gets reflectivity of a physics material, resolving it only on the first hit of that material.
+        float GetMaterialReflectivity(const Physics::MaterialId& materialId) const;
+
         LidarId m_busId;
         //! EntityId that is used to acquire the physics scene handle.
         AZ::EntityId m_sceneEntityId;
@@ -48,8 +93,27 @@ namespace ROS2
         float m_minRange{ 0.0f };
         float m_range{ 1.0f };
         bool m_addMaxRangePoints{ false };
+        bool m_parallelDispatch{ false };
         AZStd::vector<AZ::Vector3> m_rayRotations{ { AZ::Vector3::CreateZero() } };
+        AZStd::vector<AZ::u16> m_rayRings;
 
         AZStd::unordered_set<AZ::u32> m_ignoredCollisionLayers;
+
+        //! Cache of ray directions owned by the lidar registrar.
+        LidarTemplateUtils::RayDirectionsCache* m_rayDirectionsCache{ nullptr };
+        //! Ray directions in the lidar reference frame, computed from m_rayRotations and shared with lidars using the same rotations.
+        AZStd::shared_ptr<const LidarTemplateUtils::RayDirections> m_localRayDirections;
+        //! Ray directions in the world reference frame, updated in place on each scan.
+        LidarTemplateUtils::RayDirections m_rayDirections;
+        //! Persistent pool of ray cast requests, reused between scans.
+        AzPhysics::SceneQueryRequests m_requests;
+        //! Requests of m_requests split into batches of ParallelDispatchChunkSize, each submitted as a single scene query batch.
+        AZStd::vector<AzPhysics::SceneQueryRequests> m_requestBatches;
+        //! Per-ray hit buffers, reused between scans.
+        AZStd::vector<AzPhysics::SceneQueryHits> m_hits;
+        //! Whether the request pool needs to be rebuilt before the next scan.
+        bool m_requestsDirty{ true };
+        //! Reflectivities of physics materials hit so far, used to compute intensities.
+        mutable AZStd::vector<AZStd::pair<Physics::MaterialId, float>> m_materialReflectivities;
     };
 } // namespace ROS2
@@ -35,12 +35,15 @@ namespace ROS2
 
     void LidarRegistrarSystemComponent::Activate()
     {
-        m_physxLidarSystem.Activate();
+        m_physxLidarSystem.Activate(&m_rayDirectionsCache);
+        m_lidarScheduler.Activate(&m_physxLidarSystem);
     }
 
     void LidarRegistrarSystemComponent::Deactivate()
     {
+        m_lidarScheduler.Deactivate();
         m_physxLidarSystem.Deactivate();
+        m_rayDirectionsCache.Clear();
     }
 
     void LidarRegistrarSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <Lidar/LidarScheduler.h>
 #include <Lidar/LidarSystem.h>
 #include <ROS2/Lidar/LidarRegistrarBus.h>
 
@@ -42,7 +43,10 @@ namespace ROS2
         const LidarSystemMetaData* GetLidarSystemMetaData(const AZStd::string& name) const override;
 
     private:
+        //! Ray directions shared by lidars of the Scene Queries lidar system, declared first to outlive them.
+        LidarTemplateUtils::RayDirectionsCache m_rayDirectionsCache;
         LidarSystem m_physxLidarSystem;
+        LidarScheduler m_lidarScheduler;
         AZStd::unordered_map<AZ::Crc32, LidarSystemMetaData> m_registeredLidarSystems;
     };
 
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <Lidar/LidarRaycaster.h>
+#include <Lidar/LidarScheduler.h>
+#include <Lidar/LidarSystem.h>
+
+namespace ROS2
+{
+    LidarScheduler::LidarScheduler()
+    {
+        if (!LidarSchedulerInterface::Get())
+        {
+            LidarSchedulerInterface::Register(this);
+        }
+    }
+
+    LidarScheduler::~LidarScheduler()
+    {
+        if (LidarSchedulerInterface::Get() == this)
+        {
+            LidarSchedulerInterface::Unregister(this);
+        }
+    }
+
+    void LidarScheduler::Activate(LidarSystem* lidarSystem)
+    {
+        m_lidarSystem = lidarSystem;
+        m_onSceneSimulationFinishHandler = AzPhysics::SceneEvents::OnSceneSimulationFinishHandler(
+            [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float deltaTime)
+            {
+                OnSceneSimulationFinish(deltaTime);
+            });
+    }
+
+    void LidarScheduler::Deactivate()
+    {
+        m_onSceneSimulationFinishHandler.Disconnect();
+        for (auto& [lidarId, scheduledLidar] : m_scheduledLidars)
+        {
+            UnregisterFromSensorScheduler(scheduledLidar);
+        }
+        m_scheduledLidars.clear();
+        m_lidarSystem = nullptr;
+    }
+
+    bool LidarScheduler::RegisterLidar(
+        LidarId lidarId, AZ::EntityId entityId, float frequency, RaycastResult* results, ResultsCallback callback)
+    {
+        AZ_Assert(results, "Scheduled lidar requires a results buffer.");
+        if (!m_lidarSystem)
+        {
+            return false;
+        }
+
+        LidarRaycaster* raycaster = m_lidarSystem->GetRaycaster(lidarId);
+        if (!raycaster)
+        {
+            AZ_Warning("LidarScheduler", false, "Only lidars created by the Scene Queries lidar system can be scheduled.");
+            return false;
+        }
+
+        AZ::Entity* entity = nullptr;
+        AZ::ComponentApplicationBus::BroadcastResult(entity, &AZ::ComponentApplicationRequests::FindEntity, entityId);
+        auto* transformInterface = entity ? entity->FindComponent<AzFramework::TransformComponent>() : nullptr;
+        if (!transformInterface)
+        {
+            AZ_Warning("LidarScheduler", false, "Unable to schedule a lidar on entity without a transform.");
+            return false;
+        }
+
+        if (!ConnectToPhysicsScene())
+        {
+            AZ_Warning("LidarScheduler", false, "Unable to schedule a lidar without the default physics scene.");
+            return false;
+        }
+
+        ScheduledLidar& scheduledLidar = m_scheduledLidars[lidarId];
+        UnregisterFromSensorScheduler(scheduledLidar);
+        scheduledLidar = {};
+        scheduledLidar.m_raycaster = raycaster;
+        scheduledLidar.m_transformInterface = transformInterface;
+        scheduledLidar.m_results = results;
+        scheduledLidar.m_callback = AZStd::move(callback);
+        scheduledLidar.m_period = frequency > 0.0f ? 1.0f / frequency : 1.0f;
+        if (auto* sensorScheduler = SensorSchedulerInterface::Get())
+        {
+            scheduledLidar.m_scheduleId = sensorScheduler->RegisterSensor(frequency);
+        }
+        return true;
+    }
+
+    void LidarScheduler::UnregisterLidar(LidarId lidarId)
+    {
+        if (auto lidarIt = m_scheduledLidars.find(lidarId); lidarIt != m_scheduledLidars.end())
+        {
+            UnregisterFromSensorScheduler(lidarIt->second);
+            m_scheduledLidars.erase(lidarIt);
+        }
+        if (m_scheduledLidars.empty())
+        {
+            m_onSceneSimulationFinishHandler.Disconnect();
+        }
+    }
+
+    bool LidarScheduler::ConnectToPhysicsScene()
+    {
+        if (m_onSceneSimulationFinishHandler.IsConnected())
+        {
+            return true;
+        }
+
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if (!sceneInterface)
+        {
+            return false;
+        }
+        AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+        if (sceneHandle == AzPhysics::InvalidSceneHandle)
+        {
+            return false;
+        }
+
+        sceneInterface->RegisterSceneSimulationFinishHandler(sceneHandle, m_onSceneSimulationFinishHandler);
+        return true;
+    }
+
+    bool LidarScheduler::IsRaycastDue(ScheduledLidar& scheduledLidar, float deltaTime)
+    {
+        if (scheduledLidar.m_scheduleId != InvalidSensorScheduleId)
+        {
+            auto* sensorScheduler = SensorSchedulerInterface::Get();
+            if (sensorScheduler && sensorScheduler->IsSensorRegistered(scheduledLidar.m_scheduleId))
+            {
+                return sensorScheduler->IsPublicationDeadline(scheduledLidar.m_scheduleId);
+            }
+            // The sensor scheduler was deactivated or destroyed, keep raycasting at the lidar frequency with the timer.
+            scheduledLidar.m_scheduleId = InvalidSensorScheduleId;
+        }
+
+        scheduledLidar.m_timeToNextRaycast -= deltaTime;
+        if (scheduledLidar.m_timeToNextRaycast > 0.0f)
+        {
+            return false;
+        }
+        // Do not try to catch up with raycasts that were missed, e.g. due to a frequency higher than the physics step rate.
+        scheduledLidar.m_timeToNextRaycast = AZStd::max(scheduledLidar.m_timeToNextRaycast + scheduledLidar.m_period, 0.0f);
+        return true;
+    }
+
+    void LidarScheduler::UnregisterFromSensorScheduler(ScheduledLidar& scheduledLidar)
+    {
+        auto* sensorScheduler = SensorSchedulerInterface::Get();
+        if (sensorScheduler && scheduledLidar.m_scheduleId != InvalidSensorScheduleId)
+        {
+            sensorScheduler->UnregisterSensor(scheduledLidar.m_scheduleId);
+        }
+        scheduledLidar.m_scheduleId = InvalidSensorScheduleId;
+    }
+
+    void LidarScheduler::OnSceneSimulationFinish(float deltaTime)
+    {
+        m_dueLidars.clear();
+        m_rayChunks.clear();
+        for (auto& [lidarId, scheduledLidar] : m_scheduledLidars)
+        {
+            if (!IsRaycastDue(scheduledLidar, deltaTime))
+            {
+                continue;
+            }
+
+            scheduledLidar.m_lidarTransform = scheduledLidar.m_transformInterface->GetWorldTM();
+            const size_t rayCount = scheduledLidar.m_raycaster->PrepareRaycast(scheduledLidar.m_lidarTransform);
+            for (size_t begin = 0; begin < rayCount; begin += LidarRaycaster::ParallelDispatchChunkSize)
+            {
+                const size_t end = AZStd::min(begin + LidarRaycaster::ParallelDispatchChunkSize, rayCount);
+                m_rayChunks.push_back({ scheduledLidar.m_raycaster, begin, end });
+            }
+            m_dueLidars.push_back(&scheduledLidar);
+        }
+
+        if (m_rayChunks.size() == 1)
+        {
+            m_rayChunks.front().m_raycaster->QueryRays(m_rayChunks.front().m_begin, m_rayChunks.front().m_end);
+        }
+        else if (m_rayChunks.size() > 1)
+        {
+            // Chunks of all due lidars are dispatched together, so the scene is queried in a single batch.
+            AZ::JobCompletion jobCompletion;
+            for (const RayChunk& chunk : m_rayChunks)
+            {
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [chunk]()
+                    {
+                        chunk.m_raycaster->QueryRays(chunk.m_begin, chunk.m_end);
+                    },
+                    true);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        for (ScheduledLidar* scheduledLidar : m_dueLidars)
+        {
+            scheduledLidar->m_raycaster->CollectResults(scheduledLidar->m_lidarTransform, *scheduledLidar->m_results);
+            if (scheduledLidar->m_callback)
+            {
+                scheduledLidar->m_callback(*scheduledLidar->m_results);
+            }
+        }
+    }
+} // namespace ROS2
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <ROS2/Lidar/LidarRaycasterBus.h>
+#include <ROS2/Sensor/SensorSchedulerBus.h>
+
+namespace ROS2
+{
+    class LidarRaycaster;
+    class LidarSystem;
+
+    //! Scene-wide scheduler for lidars using the Scene Queries lidar implementation.
+    //! Lidars register with the scheduler instead of performing raycasts on their own. Once per physics step the scheduler gathers
+    //! world transforms of all lidars that are due, queries rays of all of them in a single batch dispatched on the job system and
+    //! hands the results back to each lidar. This amortizes scene locking and query setup across all lidars in the scene.
+    //! Lidars are due on physics steps assigned by the sensor scheduler (ROS2::SensorSchedulerInterface), so their raycasts are
+    //! staggered together with publications of other sensors. Without the sensor scheduler, each lidar is due once per its period.
+    class LidarScheduler
+    {
+    public:
+        AZ_RTTI(LidarScheduler, "{4f0c7b5e-2a4d-4b0c-9d6f-3e2a8c1b7d90}");
+
+        //! Callback called with results of a scheduled raycast.
+        using ResultsCallback = AZStd::function<void(const RaycastResult&)>;
+
+        LidarScheduler();
+        virtual ~LidarScheduler();
+
+        //! Starts scheduling raycasts of lidars created by the given lidar system.
+        //! @param lidarSystem Lidar system owning the raycasters of scheduled lidars.
+        void Activate(LidarSystem* lidarSystem);
+        //! Stops scheduling and unregisters all lidars.
+        void Deactivate();
+
+        //! Registers a lidar with the scheduler.
+        //! @param lidarId Id of a raycaster created by the Scene Queries lidar system.
+        //! @param entityId Entity from which the rays are sent.
+        //! @param frequency Frequency of raycasts in Hz.
+        //! @param results Buffer, owned by the caller, that receives results of scheduled raycasts. It has to outlive the registration.
+        //! @param callback Callback called after results are written to the buffer.
+        //! @return Whether the lidar was registered.
+        bool RegisterLidar(LidarId lidarId, AZ::EntityId entityId, float frequency, RaycastResult* results, ResultsCallback callback);
+
+        //! Unregisters a lidar from the scheduler.
+        //! @param lidarId Id of a previously registered lidar.
+        void UnregisterLidar(LidarId lidarId);
+
+    private:
+        struct ScheduledLidar
+        {
+            LidarRaycaster* m_raycaster = nullptr;
+            AZ::TransformInterface* m_transformInterface = nullptr;
+            RaycastResult* m_results = nullptr;
+            ResultsCallback m_callback;
+            SensorScheduleId m_scheduleId = InvalidSensorScheduleId; //!< Identifier of the lidar in the sensor scheduler.
+            float m_period = 0.0f; //!< Period of raycasts, used when the lidar is not registered with the sensor scheduler.
+            float m_timeToNextRaycast = 0.0f;
+            AZ::Transform m_lidarTransform = AZ::Transform::CreateIdentity();
+        };
+
+        //! Range of rays of a single lidar queried by a single job.
+        struct RayChunk
+        {
+            LidarRaycaster* m_raycaster = nullptr;
+            size_t m_begin = 0;
+            size_t m_end = 0;
+        };
+
+        //! Connects to the default physics scene, if not connected yet.
+        //! @return Whether the scheduler is connected to the default physics scene.
+        bool ConnectToPhysicsScene();
+        void OnSceneSimulationFinish(float deltaTime);
+
+        //! Checks whether the lidar should raycast on the current physics step.
+        static bool IsRaycastDue(ScheduledLidar& scheduledLidar, float deltaTime);
+        //! Unregisters the lidar from the sensor scheduler, if it was registered.
+        static void UnregisterFromSensorScheduler(ScheduledLidar& scheduledLidar);
+
+        LidarSystem* m_lidarSystem = nullptr;
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_onSceneSimulationFinishHandler;
+
+        AZStd::unordered_map<LidarId, ScheduledLidar> m_scheduledLidars;
+
+        //! Buffers reused between physics steps.
+        AZStd::vector<ScheduledLidar*> m_dueLidars;
+        AZStd::vector<RayChunk> m_rayChunks;
+    };
+
+    using LidarSchedulerInterface = AZ::Interface<LidarScheduler>;
+} // namespace ROS2
@@ -17,13 +17,19 @@ namespace ROS2
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<LidarSensorConfiguration>()
-                ->Version(1)
+                ->Version(5)
                 ->Field("lidarModelName", &LidarSensorConfiguration::m_lidarModelName)
                 ->Field("lidarImplementation", &LidarSensorConfiguration::m_lidarSystem)
                 ->Field("LidarParameters", &LidarSensorConfiguration::m_lidarParameters)
                 ->Field("IgnoredLayerIndices", &LidarSensorConfiguration::m_ignoredCollisionLayers)
                 ->Field("ExcludedEntities", &LidarSensorConfiguration::m_excludedEntities)
-                ->Field("PointsAtMax", &LidarSensorConfiguration::m_addPointsAtMax);
+                ->Field("PointsAtMax", &LidarSensorConfiguration::m_addPointsAtMax)
+                ->Field("ParallelDispatch", &LidarSensorConfiguration::m_parallelDispatch)
+                ->Field("SceneScheduling", &LidarSensorConfiguration::m_sceneScheduling)
+                ->Field("RollingShutter", &LidarSensorConfiguration::m_rollingShutter)
+                ->Field("IncludeIntensity", &LidarSensorConfiguration::m_includeIntensity)
+                ->Field("IncludeRing", &LidarSensorConfiguration::m_includeRing)
+                ->Field("IncludeTimeOffset", &LidarSensorConfiguration::m_includeTimeOffset);
 
             if (AZ::EditContext* ec = serializeContext->GetEditContext())
             {
@@ -63,7 +69,45 @@ namespace ROS2
                         &LidarSensorConfiguration::m_addPointsAtMax,
                         "Points at Max",
                         "If set true LiDAR will produce points at max range for free space")
-                    ->Attribute(AZ::Edit::Attributes::Visibility, &LidarSensorConfiguration::IsMaxPointsConfigurationVisible);
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &LidarSensorConfiguration::IsMaxPointsConfigurationVisible)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &LidarSensorConfiguration::m_parallelDispatch,
+                        "Parallel dispatch",
+                        "If set true LiDAR will split each scan into chunks of rays processed concurrently on the job system")
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &LidarSensorConfiguration::IsParallelDispatchConfigurationVisible)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &LidarSensorConfiguration::m_sceneScheduling,
+                        "Scene scheduling",
+                        "If set true LiDAR raycasts are performed on physics steps together with all other scheduled lidars in the scene")
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &LidarSensorConfiguration::IsSceneSchedulingConfigurationVisible)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &LidarSensorConfiguration::m_rollingShutter,
+                        "Rolling shutter",
+                        "If set true LiDAR casts a slice of its rays on each physics step and publishes the accumulated points once per "
+                        "revolution, which models motion distortion of spinning lidars")
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &LidarSensorConfiguration::IsRollingShutterConfigurationVisible)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &LidarSensorConfiguration::m_includeIntensity,
+                        "Intensity field",
+                        "If set true LiDAR points carry intensity derived from the physics material of the hit surface")
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &LidarSensorConfiguration::IsPointFieldsConfigurationVisible)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &LidarSensorConfiguration::m_includeRing,
+                        "Ring field",
+                        "If set true LiDAR points carry the index of the layer (ring) of their ray")
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &LidarSensorConfiguration::IsPointFieldsConfigurationVisible)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &LidarSensorConfiguration::m_includeTimeOffset,
+                        "Time field",
+                        "If set true LiDAR points carry their time offset in seconds relative to the beginning of the scan. "
+                        "Only published with rolling shutter, otherwise all points of a scan share its timestamp")
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &LidarSensorConfiguration::IsPointFieldsConfigurationVisible);
             }
         }
     }
@@ -140,6 +184,26 @@ namespace ROS2
         return m_lidarSystemFeatures & LidarSystemFeatures::MaxRangePoints;
     }
 
+    bool LidarSensorConfiguration::IsParallelDispatchConfigurationVisible() const
+    {
+        return m_lidarSystemFeatures & LidarSystemFeatures::ParallelDispatch;
+    }
+
+    bool LidarSensorConfiguration::IsSceneSchedulingConfigurationVisible() const
+    {
+        return m_lidarSystemFeatures & LidarSystemFeatures::SceneScheduling;
+    }
+
+    bool LidarSensorConfiguration::IsRollingShutterConfigurationVisible() const
+    {
+        return m_lidarSystemFeatures & LidarSystemFeatures::PartialScans;
+    }
+
+    bool LidarSensorConfiguration::IsPointFieldsConfigurationVisible() const
+    {
+        return m_lidarSystemFeatures & LidarSystemFeatures::PointFields;
+    }
+
     AZ::Crc32 LidarSensorConfiguration::OnLidarModelSelected()
     {
         FetchLidarModelConfiguration();
@@ -40,12 +40,22 @@ namespace ROS2
         AZStd::vector<AZ::EntityId> m_excludedEntities;
 
         bool m_addPointsAtMax = false;
+        bool m_parallelDispatch = false;
+        bool m_sceneScheduling = false;
+        bool m_rollingShutter = false;
+        bool m_includeIntensity = false;
+        bool m_includeRing = false;
+        bool m_includeTimeOffset = false;
 
     private:
         bool IsConfigurationVisible() const;
         bool IsIgnoredLayerConfigurationVisible() const;
         bool IsEntityExclusionVisible() const;
         bool IsMaxPointsConfigurationVisible() const;
+        bool IsParallelDispatchConfigurationVisible() const;
+        bool IsSceneSchedulingConfigurationVisible() const;
+        bool IsRollingShutterConfigurationVisible() const;
+        bool IsPointFieldsConfigurationVisible() const;
 
         //! Update the lidar configuration based on the current lidar model selected.
         void FetchLidarModelConfiguration();
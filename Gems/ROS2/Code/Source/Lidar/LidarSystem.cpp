@@ -12,6 +12,7 @@ namespace ROS2
 {
     LidarSystem::LidarSystem(LidarSystem&& lidarSystem)
         : m_lidars{ AZStd::move(lidarSystem.m_lidars) }
+        , m_rayDirectionsCache{ lidarSystem.m_rayDirectionsCache }
     {
         lidarSystem.BusDisconnect();
     }
@@ -22,11 +23,15 @@ namespace ROS2
         return lidarSystem;
     }
 
-    void LidarSystem::Activate()
+    void LidarSystem::Activate(LidarTemplateUtils::RayDirectionsCache* rayDirectionsCache)
     {
+        m_rayDirectionsCache = rayDirectionsCache;
+
         static constexpr const char* Description = "Collider-based lidar implementation that uses the PhysX engine's raycasting.";
-        static constexpr auto SupportedFeatures =
-            aznumeric_cast<LidarSystemFeatures>(LidarSystemFeatures::CollisionLayers | LidarSystemFeatures::MaxRangePoints);
+        static constexpr auto SupportedFeatures = aznumeric_cast<LidarSystemFeatures>(
+            LidarSystemFeatures::CollisionLayers | LidarSystemFeatures::MaxRangePoints | LidarSystemFeatures::ParallelDispatch |
+            LidarSystemFeatures::SceneScheduling | LidarSystemFeatures::LocalFramePoints | LidarSystemFeatures::PartialScans |
+            LidarSystemFeatures::PointFields);
 
         LidarSystemRequestBus::Handler::BusConnect(AZ_CRC(SystemName));
 
@@ -50,7 +55,7 @@ namespace ROS2
     LidarId LidarSystem::CreateLidar(AZ::EntityId lidarEntityId)
     {
         LidarId lidarId = LidarId::CreateRandom();
-        m_lidars.emplace(lidarId, LidarRaycaster(lidarId, lidarEntityId));
+        m_lidars.emplace(lidarId, LidarRaycaster(lidarId, lidarEntityId, m_rayDirectionsCache));
         return lidarId;
     }
 
@@ -58,4 +63,14 @@ namespace ROS2
     {
         m_lidars.erase(lidarId);
     }
+
+    LidarRaycaster* LidarSystem::GetRaycaster(LidarId lidarId)
+    {
+        if (auto lidar = m_lidars.find(lidarId); lidar != m_lidars.end())
+        {
+            return &lidar->second;
+        }
+
+        return nullptr;
+    }
 } // namespace ROS2
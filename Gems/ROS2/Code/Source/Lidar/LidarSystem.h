@@ -23,9 +23,16 @@ namespace ROS2
 
         ~LidarSystem() = default;
 
-        void Activate();
+        //! Registers the lidar system and starts handling lidar creation requests.
+        //! @param rayDirectionsCache Cache of ray directions shared by lidars created by this system. It has to outlive the lidars.
+        void Activate(LidarTemplateUtils::RayDirectionsCache* rayDirectionsCache = nullptr);
         void Deactivate();
 
+        //! Returns the raycaster of a lidar created by this system.
+        //! @param lidarId Id of the lidar.
+        //! @return Pointer to the raycaster or nullptr if no lidar with the given id was created by this system.
+        LidarRaycaster* GetRaycaster(LidarId lidarId);
+
     private:
         static constexpr const char* SystemName = "Scene Queries";
 
@@ -34,5 +41,6 @@ namespace ROS2
         void DestroyLidar(LidarId lidarId) override;
 
         AZStd::unordered_map<LidarId, LidarRaycaster> m_lidars;
+        LidarTemplateUtils::RayDirectionsCache* m_rayDirectionsCache = nullptr;
     };
 } // namespace ROS2
@@ -7,7 +7,9 @@
  */
 
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Simd.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <Lidar/LidarTemplateUtils.h>
 
 namespace ROS2
@@ -265,6 +267,21 @@ namespace ROS2
         return rotations;
     }
 
+    AZStd::vector<AZ::u16> LidarTemplateUtils::PopulateRayRings(const LidarTemplate& lidarTemplate)
+    {
+        AZStd::vector<AZ::u16> rings;
+        rings.reserve(TotalPointCount(lidarTemplate));
+        for (unsigned int incr = 0; incr < lidarTemplate.m_numberOfIncrements; incr++)
+        {
+            for (unsigned int layer = 0; layer < lidarTemplate.m_layers; layer++)
+            {
+                rings.push_back(aznumeric_cast<AZ::u16>(layer));
+            }
+        }
+
+        return rings;
+    }
+
     AZStd::vector<AZ::Vector3> LidarTemplateUtils::RotationsToDirections(
         const AZStd::vector<AZ::Vector3>& rotations, const AZ::Transform& rootTransform)
     {
@@ -279,4 +296,94 @@ namespace ROS2
 
         return directions;
     }
+
+    void LidarTemplateUtils::RayDirections::Resize(size_t count)
+    {
+        m_x.resize(count);
+        m_y.resize(count);
+        m_z.resize(count);
+    }
+
+    size_t LidarTemplateUtils::RayDirections::Size() const
+    {
+        return m_x.size();
+    }
+
+    LidarTemplateUtils::RayDirections LidarTemplateUtils::RotationsToLocalDirections(const AZStd::vector<AZ::Vector3>& rotations)
+    {
+        RayDirections directions;
+        directions.Resize(rotations.size());
+        for (size_t i = 0; i < rotations.size(); ++i)
+        {
+            const AZ::Vector3& angle = rotations[i];
+            const AZ::Vector3 direction =
+                AZ::Quaternion::CreateFromEulerRadiansZYX({ 0.0f, -angle.GetY(), angle.GetZ() }).TransformVector(AZ::Vector3::CreateAxisX());
+            directions.m_x[i] = direction.GetX();
+            directions.m_y[i] = direction.GetY();
+            directions.m_z[i] = direction.GetZ();
+        }
+
+        return directions;
+    }
+
+    AZStd::shared_ptr<const LidarTemplateUtils::RayDirections> LidarTemplateUtils::GetCachedLocalDirections(
+        RayDirectionsCache& cache, const AZStd::vector<AZ::Vector3>& rotations)
+    {
+        return cache.GetOrCreate(
+            rotations,
+            [&rotations]()
+            {
+                return AZStd::make_shared<const RayDirections>(RotationsToLocalDirections(rotations));
+            });
+    }
+
+    void LidarTemplateUtils::RotateDirections(const RayDirections& localDirections, const AZ::Matrix3x3& rotation, RayDirections& directions)
+    {
+        RotateDirections(localDirections, rotation, directions, 0, localDirections.Size());
+    }
+
+    void LidarTemplateUtils::RotateDirections(
+        const RayDirections& localDirections, const AZ::Matrix3x3& rotation, RayDirections& directions, size_t begin, size_t end)
+    {
+        using AZ::Simd::Vec4;
+        AZ_Assert(begin <= end && end <= localDirections.Size(), "Invalid range of ray directions to rotate.");
+        directions.Resize(localDirections.Size());
+
+        const float* localX = localDirections.m_x.data();
+        const float* localY = localDirections.m_y.data();
+        const float* localZ = localDirections.m_z.data();
+        float* resultX = directions.m_x.data();
+        float* resultY = directions.m_y.data();
+        float* resultZ = directions.m_z.data();
+
+        const Vec4::FloatType m00 = Vec4::Splat(rotation.GetElement(0, 0));
+        const Vec4::FloatType m01 = Vec4::Splat(rotation.GetElement(0, 1));
+        const Vec4::FloatType m02 = Vec4::Splat(rotation.GetElement(0, 2));
+        const Vec4::FloatType m10 = Vec4::Splat(rotation.GetElement(1, 0));
+        const Vec4::FloatType m11 = Vec4::Splat(rotation.GetElement(1, 1));
+        const Vec4::FloatType m12 = Vec4::Splat(rotation.GetElement(1, 2));
+        const Vec4::FloatType m20 = Vec4::Splat(rotation.GetElement(2, 0));
+        const Vec4::FloatType m21 = Vec4::Splat(rotation.GetElement(2, 1));
+        const Vec4::FloatType m22 = Vec4::Splat(rotation.GetElement(2, 2));
+
+        // Four rays are rotated at once; the structure of arrays layout makes loads and stores contiguous.
+        size_t i = begin;
+        for (; i + 4 <= end; i += 4)
+        {
+            const Vec4::FloatType x = Vec4::LoadUnaligned(localX + i);
+            const Vec4::FloatType y = Vec4::LoadUnaligned(localY + i);
+            const Vec4::FloatType z = Vec4::LoadUnaligned(localZ + i);
+            Vec4::StoreUnaligned(resultX + i, Vec4::Madd(m02, z, Vec4::Madd(m01, y, Vec4::Mul(m00, x))));
+            Vec4::StoreUnaligned(resultY + i, Vec4::Madd(m12, z, Vec4::Madd(m11, y, Vec4::Mul(m10, x))));
+            Vec4::StoreUnaligned(resultZ + i, Vec4::Madd(m22, z, Vec4::Madd(m21, y, Vec4::Mul(m20, x))));
+        }
+
+        for (; i < end; ++i)
+        {
+            const AZ::Vector3 direction = rotation * AZ::Vector3(localX[i], localY[i], localZ[i]);
+            resultX[i] = direction.GetX();
+            resultY[i] = direction.GetY();
+            resultZ[i] = direction.GetZ();
+        }
+    }
 } // namespace ROS2
@@ -7,9 +7,12 @@
  */
 #pragma once
 
+#include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <Lidar/LidarTemplate.h>
+#include <Utilities/SharedResourceCache.h>
 
 namespace ROS2
 {
@@ -39,10 +42,59 @@ namespace ROS2
         //! @return Ray rotations angles as Euler angles in radians.
         AZStd::vector<AZ::Vector3> PopulateRayRotations(const LidarTemplate& lidarTemplate);
 
+        //! Compute ray rings based on lidar model.
+        //! @param lidarTemplate Lidar model to use.
+        //! @return Ring (layer index) of each ray, in the order of rays returned by PopulateRayRotations.
+        AZStd::vector<AZ::u16> PopulateRayRings(const LidarTemplate& lidarTemplate);
+
         //! Compute ray directions from rotations.
         //! @param rotations Rotations as Euler angles in radians to compute directions from.
         //! @param rootRotation Root rotation as Euler angles in radians.
         //! @return Ray directions constructed by transforming an X axis unit vector by the provided rotations.
         AZStd::vector<AZ::Vector3> RotationsToDirections(const AZStd::vector<AZ::Vector3>& rotations, const AZ::Transform& rootTransform);
+
+        //! Unit ray directions stored as a structure of arrays (one array per coordinate), so that they can be transformed in tight loops.
+        struct RayDirections
+        {
+            void Resize(size_t count);
+            size_t Size() const;
+
+            AZStd::vector<float> m_x;
+            AZStd::vector<float> m_y;
+            AZStd::vector<float> m_z;
+        };
+
+        //! Compute ray directions in the lidar reference frame from rotations.
+        //! @param rotations Rotations as Euler angles in radians to compute directions from.
+        //! @return Ray directions constructed by transforming an X axis unit vector by the provided rotations.
+        RayDirections RotationsToLocalDirections(const AZStd::vector<AZ::Vector3>& rotations);
+
+        //! Cache of ray directions in the lidar reference frame, keyed by ray rotations.
+        using RayDirectionsCache = SharedResourceCache<AZStd::vector<AZ::Vector3>, const RayDirections>;
+
+        //! Get ray directions in the lidar reference frame for the given rotations, computing them only if needed.
+        //! Directions are shared between all lidars using the same rotations (i.e. the same lidar template)
+        //! for as long as any of them holds the returned pointer.
+        //! @param cache Cache of directions shared between lidars.
+        //! @param rotations Rotations as Euler angles in radians to compute directions from.
+        //! @return Shared ray directions in the lidar reference frame.
+        AZStd::shared_ptr<const RayDirections> GetCachedLocalDirections(
+            RayDirectionsCache& cache, const AZStd::vector<AZ::Vector3>& rotations);
+
+        //! Rotate ray directions, processing several rays at once with SIMD instructions.
+        //! @param localDirections Directions to rotate.
+        //! @param rotation Rotation matrix applied to each direction.
+        //! @param directions Buffer that receives rotated directions. Its capacity is reused between calls.
+        void RotateDirections(const RayDirections& localDirections, const AZ::Matrix3x3& rotation, RayDirections& directions);
+
+        //! Rotate ray directions in range [begin, end), processing several rays at once with SIMD instructions.
+        //! Directions outside of the range are left unchanged.
+        //! @param localDirections Directions to rotate.
+        //! @param rotation Rotation matrix applied to each direction.
+        //! @param directions Buffer that receives rotated directions. It is resized to the size of localDirections.
+        //! @param begin Index of the first direction to rotate.
+        //! @param end Index one past the last direction to rotate.
+        void RotateDirections(
+            const RayDirections& localDirections, const AZ::Matrix3x3& rotation, RayDirections& directions, size_t begin, size_t end);
     }; // namespace LidarTemplateUtils
 } // namespace ROS2
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Math/Transform.h>
+#include <ROS2/Lidar/LidarRaycasterBus.h>
+#include <sensor_msgs/msg/point_field.hpp>
+
+namespace ROS2
+{
+    //! Compile-time descriptions of packed PointCloud2 point layouts.
+    //! A layout is a list of point fields. Each field knows its size, its PointField descriptions and how to write itself for a point,
+    //! so that a layout writes all requested fields of every point in a single pass over the raycast results.
+    namespace PointCloudLayout
+    {
+        //! Data from which fields of a single point are written.
+        struct PointSource
+        {
+            const RaycastResult& m_results;
+            const AZ::Transform& m_sensorFromResults;
+            bool m_transformPoints;
+        };
+
+        namespace Detail
+        {
+            inline void AddField(
+                std::vector<sensor_msgs::msg::PointField>& fields, const char* name, AZ::u32 offset, AZ::u8 datatype)
+            {
+                sensor_msgs::msg::PointField field;
+                field.name = name;
+                field.offset = offset;
+                field.datatype = datatype;
+                field.count = 1;
+                fields.push_back(field);
+            }
+        } // namespace Detail
+
+        //! Point coordinates in sensor frame, as x, y and z float fields.
+        struct Position
+        {
+            static constexpr AZ::u32 Size = 3 * sizeof(float);
+
+            static void Describe(std::vector<sensor_msgs::msg::PointField>& fields, AZ::u32 offset)
+            {
+                Detail::AddField(fields, "x", offset, sensor_msgs::msg::PointField::FLOAT32);
+                Detail::AddField(fields, "y", offset + sizeof(float), sensor_msgs::msg::PointField::FLOAT32);
+                Detail::AddField(fields, "z", offset + 2 * sizeof(float), sensor_msgs::msg::PointField::FLOAT32);
+            }
+
+            static bool IsAvailable([[maybe_unused]] const RaycastResult& results)
+            {
+                return true;
+            }
+
+            static void Write(AZ::u8* destination, const PointSource& source, size_t index)
+            {
+                const AZ::Vector3& point = source.m_results.m_points[index];
+                const AZ::Vector3 sensorPoint = source.m_transformPoints ? source.m_sensorFromResults.TransformPoint(point) : point;
+                const float xyz[3] = { sensorPoint.GetX(), sensorPoint.GetY(), sensorPoint.GetZ() };
+                memcpy(destination, xyz, sizeof(xyz));
+            }
+        };
+
+        //! Point intensity as a float field.
+        struct Intensity
+        {
+            static constexpr AZ::u32 Size = sizeof(float);
+
+            static void Describe(std::vector<sensor_msgs::msg::PointField>& fields, AZ::u32 offset)
+            {
+                Detail::AddField(fields, "intensity", offset, sensor_msgs::msg::PointField::FLOAT32);
+            }
+
+            static bool IsAvailable(const RaycastResult& results)
+            {
+                return results.m_intensities.size() == results.m_points.size();
+            }
+
+            static void Write(AZ::u8* destination, const PointSource& source, size_t index)
+            {
+                memcpy(destination, &source.m_results.m_intensities[index], Size);
+            }
+        };
+
+        //! Point ring (lidar template layer index) as an unsigned 16-bit field.
+        struct Ring
+        {
+            static constexpr AZ::u32 Size = sizeof(AZ::u16);
+
+            static void Describe(std::vector<sensor_msgs::msg::PointField>& fields, AZ::u32 offset)
+            {
+                Detail::AddField(fields, "ring", offset, sensor_msgs::msg::PointField::UINT16);
+            }
+
+            static bool IsAvailable(const RaycastResult& results)
+            {
+                return results.m_rings.size() == results.m_points.size();
+            }
+
+            static void Write(AZ::u8* destination, const PointSource& source, size_t index)
+            {
+                memcpy(destination, &source.m_results.m_rings[index], Size);
+            }
+        };
+
+        //! Point time offset relative to the message stamp, in seconds, as a float field.
+        struct TimeOffset
+        {
+            static constexpr AZ::u32 Size = sizeof(float);
+
+            static void Describe(std::vector<sensor_msgs::msg::PointField>& fields, AZ::u32 offset)
+            {
+                Detail::AddField(fields, "time", offset, sensor_msgs::msg::PointField::FLOAT32);
+            }
+
+            static bool IsAvailable(const RaycastResult& results)
+            {
+                return results.m_timeOffsets.size() == results.m_points.size();
+            }
+
+            static void Write(AZ::u8* destination, const PointSource& source, size_t index)
+            {
+                memcpy(destination, &source.m_results.m_timeOffsets[index], Size);
+            }
+        };
+
+        //! Packed layout of consecutive point fields.
+        template<typename... Fields>
+        struct PointLayout
+        {
+            static constexpr AZ::u32 PointStep = (Fields::Size + ...);
+
+            //! Appends PointField descriptions of all fields.
+            static void Describe(std::vector<sensor_msgs::msg::PointField>& fields)
+            {
+                AZ::u32 offset = 0;
+                ((Fields::Describe(fields, offset), offset += Fields::Size), ...);
+            }
+
+            //! Checks whether results contain all channels needed by the fields.
+            static bool IsAvailable(const RaycastResult& results)
+            {
+                return (Fields::IsAvailable(results) && ...);
+            }
+
+            //! Writes all points of the source to a buffer of pointCount * PointStep bytes.
+            static void Write(AZ::u8* destination, const PointSource& source, size_t pointCount)
+            {
+                for (size_t i = 0; i < pointCount; ++i)
+                {
+                    AZ::u8* fieldDestination = destination;
+                    ((Fields::Write(fieldDestination, source, i), fieldDestination += Fields::Size), ...);
+                    destination += PointStep;
+                }
+            }
+        };
+    } // namespace PointCloudLayout
+} // namespace ROS2
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Lidar/PointCloudMessageBuilder.h>
+
+namespace ROS2
+{
+    namespace
+    {
+        bool HasFlag(RaycastResultFlags flags, RaycastResultFlags flag)
+        {
+            return (flags & flag) == flag;
+        }
+    } // namespace
+
+    template<typename Layout>
+    void PointCloudMessageBuilder::SelectLayout()
+    {
+        m_template.point_step = Layout::PointStep;
+        m_template.fields.clear();
+        Layout::Describe(m_template.fields);
+        m_isLayoutAvailable = &Layout::IsAvailable;
+        m_writePoints = &Layout::Write;
+    }
+
+    void PointCloudMessageBuilder::Init(const AZStd::string& frameId, RaycastResultFlags resultFlags)
+    {
+        using namespace PointCloudLayout;
+
+        m_template = sensor_msgs::msg::PointCloud2();
+        m_template.header.frame_id = frameId.c_str();
+        m_template.height = 1;
+        m_template.is_bigendian = false;
+
+        const bool hasIntensity = HasFlag(resultFlags, RaycastResultFlags::Intensity);
+        const bool hasRing = HasFlag(resultFlags, RaycastResultFlags::Ring);
+        const bool hasTimeOffset = HasFlag(resultFlags, RaycastResultFlags::TimeOffset);
+        const int layoutIndex = (hasIntensity ? 1 : 0) | (hasRing ? 2 : 0) | (hasTimeOffset ? 4 : 0);
+        switch (layoutIndex)
+        {
+        case 0:
+            SelectLayout<PointLayout<Position>>();
+            break;
+        case 1:
+            SelectLayout<PointLayout<Position, Intensity>>();
+            break;
+        case 2:
+            SelectLayout<PointLayout<Position, Ring>>();
+            break;
+        case 3:
+            SelectLayout<PointLayout<Position, Intensity, Ring>>();
+            break;
+        case 4:
+            SelectLayout<PointLayout<Position, TimeOffset>>();
+            break;
+        case 5:
+            SelectLayout<PointLayout<Position, Intensity, TimeOffset>>();
+            break;
+        case 6:
+            SelectLayout<PointLayout<Position, Ring, TimeOffset>>();
+            break;
+        default:
+            SelectLayout<PointLayout<Position, Intensity, Ring, TimeOffset>>();
+            break;
+        }
+    }
+
+    void PointCloudMessageBuilder::Fill(
+        sensor_msgs::msg::PointCloud2& message,
+        const RaycastResult& results,
+        const AZ::Transform& sensorFromResults,
+        const builtin_interfaces::msg::Time& stamp) const
+    {
+        AZ_Assert(m_writePoints, "PointCloudMessageBuilder is not initialized.");
+        if (message.fields.empty())
+        {
+            message.header.frame_id = m_template.header.frame_id;
+            message.height = m_template.height;
+            message.point_step = m_template.point_step;
+            message.is_bigendian = m_template.is_bigendian;
+            message.fields = m_template.fields;
+        }
+
+        message.header.stamp = stamp;
+        if (!m_isLayoutAvailable(results))
+        {
+            AZ_Error("PointCloudMessageBuilder", false, "Raycast results do not contain all channels of the point cloud layout.");
+            message.width = 0;
+            message.row_step = 0;
+            message.data.clear();
+            return;
+        }
+
+        message.width = aznumeric_cast<AZ::u32>(results.m_points.size());
+        message.row_step = message.width * message.point_step;
+        message.data.resize(message.row_step * message.height);
+
+        // Transformation to sensor frame is fused with writing to the message buffer, so points are read and written only once.
+        const bool transformPoints = !sensorFromResults.IsClose(AZ::Transform::CreateIdentity());
+        const PointCloudLayout::PointSource source{ results, sensorFromResults, transformPoints };
+        m_writePoints(message.data.data(), source, results.m_points.size());
+    }
+
+    AZ::u32 PointCloudMessageBuilder::GetPointStep() const
+    {
+        return m_template.point_step;
+    }
+} // namespace ROS2
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/string/string.h>
+#include <Lidar/PointCloudLayout.h>
+#include <ROS2/Lidar/LidarRaycasterBus.h>
+#include <builtin_interfaces/msg/time.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+namespace ROS2
+{
+    //! Builds PointCloud2 messages from raycast results.
+    //! The message header and field layout are built once. Points are then written straight into the message buffer in a packed
+    //! layout (without the padding of AZ::Vector3), transforming them to sensor frame on the way if needed.
+    //! Fields of the layout (x, y, z and optionally intensity, ring and time) are selected at initialization from compile-time
+    //! layouts (see PointCloudLayout), so all of them are written in a single pass over the results.
+    class PointCloudMessageBuilder
+    {
+    public:
+        //! Builds the message template.
+        //! @param frameId Id of the ROS 2 frame of the sensor.
+        //! @param resultFlags Flags of requested raycast results. Intensity, Ring and TimeOffset flags add matching point fields.
+        void Init(const AZStd::string& frameId, RaycastResultFlags resultFlags = RaycastResultFlags::Points);
+
+        //! Writes results into the message.
+        //! Header and fields are copied from the template only if the message does not have them yet (e.g. a new message),
+        //! so filling the same message repeatedly does not allocate once its data buffer has grown to the scan size.
+        //! @param message Message to fill.
+        //! @param results Results of a raycast. They must contain every channel of the layout.
+        //! @param sensorFromResults Transform from the frame of result points to sensor frame. It is skipped when it is the identity.
+        //! @param stamp Timestamp of the message.
+        void Fill(
+            sensor_msgs::msg::PointCloud2& message,
+            const RaycastResult& results,
+            const AZ::Transform& sensorFromResults,
+            const builtin_interfaces::msg::Time& stamp) const;
+
+        //! Get the size in bytes of a single packed point.
+        //! @return Point step of the selected layout.
+        AZ::u32 GetPointStep() const;
+
+    private:
+        template<typename Layout>
+        void SelectLayout();
+
+        using IsAvailableFunction = bool (*)(const RaycastResult&);
+        using WriteFunction = void (*)(AZ::u8*, const PointCloudLayout::PointSource&, size_t);
+
+        sensor_msgs::msg::PointCloud2 m_template;
+        IsAvailableFunction m_isLayoutAvailable = nullptr;
+        WriteFunction m_writePoints = nullptr;
+    };
+} // namespace ROS2
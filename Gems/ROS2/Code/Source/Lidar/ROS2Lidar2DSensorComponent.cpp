@@ -72,11 +72,22 @@ namespace ROS2
         AZStd::string fullTopic = ROS2Names::GetNamespacedName(GetNamespace(), publisherConfig.m_topic);
         m_laserScanPublisher = ros2Node->create_publisher<sensor_msgs::msg::LaserScan>(fullTopic.data(), publisherConfig.GetQoS());
 
+        m_isScheduled = m_lidarCore.StartScheduledRaycasts(
+            m_sensorConfiguration.m_frequency,
+            [this](const RaycastResult& results)
+            {
+                if (!m_sensorConfiguration.m_publishingEnabled)
+                {
+                    return;
+                }
+                PublishRaycastResults(results);
+            });
+
         StartSensor(
             m_sensorConfiguration.m_frequency,
             [this]([[maybe_unused]] auto&&... args)
             {
-                if (!m_sensorConfiguration.m_publishingEnabled)
+                if (!m_sensorConfiguration.m_publishingEnabled || m_isScheduled)
                 {
                     return;
                 }
@@ -89,14 +100,16 @@ namespace ROS2
                     return;
                 }
                 m_lidarCore.VisualizeResults();
-            });
+            },
+            !m_isScheduled);
     }
 
     void ROS2Lidar2DSensorComponent::Deactivate()
     {
         StopSensor();
-        m_laserScanPublisher.reset();
         m_lidarCore.Deinit();
+        m_isScheduled = false;
+        m_laserScanPublisher.reset();
     }
 
     void ROS2Lidar2DSensorComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
@@ -106,8 +119,11 @@ namespace ROS2
 
     void ROS2Lidar2DSensorComponent::FrequencyTick()
     {
-        RaycastResult lastScanResults = m_lidarCore.PerformRaycast();
+        PublishRaycastResults(m_lidarCore.PerformRaycast());
+    }
 
+    void ROS2Lidar2DSensorComponent::PublishRaycastResults(const RaycastResult& lastScanResults)
+    {
         auto* ros2Frame = Utils::GetGameOrEditorComponent<ROS2FrameComponent>(GetEntity());
         auto message = sensor_msgs::msg::LaserScan();
         message.header.frame_id = ros2Frame->GetFrameID().data();
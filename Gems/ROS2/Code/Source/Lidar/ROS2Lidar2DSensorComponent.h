@@ -43,7 +43,9 @@ namespace ROS2
     private:
         //////////////////////////////////////////////////////////////////////////
         void FrequencyTick();
+        void PublishRaycastResults(const RaycastResult& lastScanResults);
 
+        bool m_isScheduled = false;
         std::shared_ptr<rclcpp::Publisher<sensor_msgs::msg::LaserScan>> m_laserScanPublisher;
 
         LidarCore m_lidarCore;
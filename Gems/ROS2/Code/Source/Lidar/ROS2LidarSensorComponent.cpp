@@ -98,13 +98,30 @@ namespace ROS2
             const TopicConfiguration& publisherConfig = m_sensorConfiguration.m_publishersConfigurations[PointCloudType];
             AZStd::string fullTopic = ROS2Names::GetNamespacedName(GetNamespace(), publisherConfig.m_topic);
             m_pointCloudPublisher = ros2Node->create_publisher<sensor_msgs::msg::PointCloud2>(fullTopic.data(), publisherConfig.GetQoS());
+            m_pointCloudMessageBuilder.Init(GetFrameID(), m_lidarCore.GetResultFlags());
+            m_pointCloudMessage = sensor_msgs::msg::PointCloud2();
+
+            StartRollingShutter();
+            if (!m_isRollingShutter)
+            {
+                m_isScheduled = m_lidarCore.StartScheduledRaycasts(
+                    m_sensorConfiguration.m_frequency,
+                    [this](const RaycastResult& results)
+                    {
+                        if (!m_sensorConfiguration.m_publishingEnabled)
+                        {
+                            return;
+                        }
+                        PublishRaycastResults(results, ROS2Interface::Get()->GetROSTimestamp());
+                    });
+            }
         }
 
         StartSensor(
             m_sensorConfiguration.m_frequency,
             [this]([[maybe_unused]] auto&&... args)
             {
-                if (!m_sensorConfiguration.m_publishingEnabled)
+                if (!m_sensorConfiguration.m_publishingEnabled || m_isScheduled || m_isRollingShutter)
                 {
                     return;
                 }
@@ -117,20 +134,21 @@ namespace ROS2
                     return;
                 }
                 m_lidarCore.VisualizeResults();
-            });
+            },
+            !m_isScheduled && !m_isRollingShutter);
     }
 
     void ROS2LidarSensorComponent::Deactivate()
     {
         StopSensor();
-        m_pointCloudPublisher.reset();
+        StopRollingShutter();
         m_lidarCore.Deinit();
+        m_isScheduled = false;
+        m_pointCloudPublisher.reset();
     }
 
     void ROS2LidarSensorComponent::FrequencyTick()
     {
-        auto entityTransform = GetEntity()->FindComponent<AzFramework::TransformComponent>();
-
         if (m_canRaycasterPublish)
         {
             const builtin_interfaces::msg::Time timestamp = ROS2Interface::Get()->GetROSTimestamp();
@@ -140,43 +158,65 @@ namespace ROS2
                 aznumeric_cast<AZ::u64>(timestamp.sec) * aznumeric_cast<AZ::u64>(1.0e9f) + timestamp.nanosec);
         }
 
-        auto lastScanResults = m_lidarCore.PerformRaycast();
+        const RaycastResult& results = m_lidarCore.PerformRaycast();
 
         if (m_canRaycasterPublish)
         { // Skip publishing when it can be handled by the raycaster.
             return;
         }
 
-        const auto inverseLidarTM = entityTransform->GetWorldTM().GetInverse();
-        for (auto& point : lastScanResults.m_points)
+        PublishRaycastResults(results, ROS2Interface::Get()->GetROSTimestamp());
+    }
+
+    void ROS2LidarSensorComponent::StartRollingShutter()
+    {
+        m_isRollingShutter = m_lidarCore.IsRollingShutterEnabled();
+        if (!m_isRollingShutter)
         {
-            point = inverseLidarTM.TransformPoint(point);
+            return;
         }
 
-        auto* ros2Frame = Utils::GetGameOrEditorComponent<ROS2FrameComponent>(GetEntity());
-        auto message = sensor_msgs::msg::PointCloud2();
-        message.header.frame_id = ros2Frame->GetFrameID().data();
-        message.header.stamp = ROS2Interface::Get()->GetROSTimestamp();
-        message.height = 1;
-        message.width = lastScanResults.m_points.size();
-        message.point_step = sizeof(AZ::Vector3);
-        message.row_step = message.width * message.point_step;
-
-        AZStd::array<const char*, 3> point_field_names = { "x", "y", "z" };
-        for (int i = 0; i < point_field_names.size(); i++)
+        m_physicsStepHandler = PhysicsBasedSource::SourceEventHandlerType(
+            [this](AzPhysics::SceneHandle sceneHandle, float deltaTime)
+            {
+                const float sliceDeltaTime = m_physicsStepSource.GetDeltaTime(sceneHandle, deltaTime);
+                if (!m_lidarCore.PerformRaycastSlice(sliceDeltaTime, m_sensorConfiguration.m_frequency))
+                {
+                    return;
+                }
+
+                if (!m_sensorConfiguration.m_publishingEnabled)
+                {
+                    return;
+                }
+
+                // The scan is stamped with the time of its first slice, as done by real spinning lidars.
+                const auto& slices = m_lidarCore.GetLastScanSlices();
+                const builtin_interfaces::msg::Time timestamp =
+                    slices.empty() ? ROS2Interface::Get()->GetROSTimestamp() : slices.front().m_timestamp;
+                PublishRaycastResults(m_lidarCore.GetLastScanResults(), timestamp);
+            });
+        m_physicsStepSource.ConnectToSourceEvent(m_physicsStepHandler);
+        m_physicsStepSource.Start();
+    }
+
+    void ROS2LidarSensorComponent::StopRollingShutter()
+    {
+        m_physicsStepSource.Stop();
+        m_physicsStepHandler.Disconnect();
+        m_isRollingShutter = false;
+    }
+
+    void ROS2LidarSensorComponent::PublishRaycastResults(const RaycastResult& results, const builtin_interfaces::msg::Time& timestamp)
+    {
+        AZ::Transform inverseLidarTM = AZ::Transform::CreateIdentity();
+        if (!m_lidarCore.ArePointsInLocalFrame())
         {
-            sensor_msgs::msg::PointField pf;
-            pf.name = point_field_names[i];
-            pf.offset = i * 4;
-            pf.datatype = sensor_msgs::msg::PointField::FLOAT32;
-            pf.count = 1;
-            message.fields.push_back(pf);
+            auto entityTransform = GetEntity()->FindComponent<AzFramework::TransformComponent>();
+            inverseLidarTM = entityTransform->GetWorldTM().GetInverse();
         }
 
-        size_t sizeInBytes = lastScanResults.m_points.size() * sizeof(AZ::Vector3);
-        message.data.resize(sizeInBytes);
-        AZ_Assert(message.row_step * message.height == sizeInBytes, "Inconsistency in the size of point cloud data");
-        memcpy(message.data.data(), lastScanResults.m_points.data(), sizeInBytes);
-        m_pointCloudPublisher->publish(message);
+        m_pointCloudMessageBuilder.Fill(m_pointCloudMessage, results, inverseLidarTM, timestamp);
+        m_pointCloudPublisher->publish(m_pointCloudMessage);
     }
 } // namespace ROS2
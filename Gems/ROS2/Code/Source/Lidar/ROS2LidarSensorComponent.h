@@ -11,6 +11,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <ROS2/Lidar/LidarRegistrarBus.h>
 #include <ROS2/Lidar/LidarSystemBus.h>
+#include <ROS2/Sensor/Events/PhysicsBasedSource.h>
 #include <ROS2/Sensor/Events/TickBasedSource.h>
 #include <ROS2/Sensor/ROS2SensorComponentBase.h>
 #include <rclcpp/publisher.hpp>
@@ -19,6 +20,7 @@
 #include "LidarCore.h"
 #include "LidarRaycaster.h"
 #include "LidarSensorConfiguration.h"
+#include "PointCloudMessageBuilder.h"
 
 namespace ROS2
 {
@@ -45,9 +47,22 @@ namespace ROS2
         //////////////////////////////////////////////////////////////////////////
         // ROS2SensorComponent overrides
         void FrequencyTick();
+        void PublishRaycastResults(const RaycastResult& results, const builtin_interfaces::msg::Time& timestamp);
+
+        //! Starts casting rolling shutter slices on physics steps, if enabled in the lidar configuration.
+        void StartRollingShutter();
+        void StopRollingShutter();
 
         bool m_canRaycasterPublish = false;
+        bool m_isScheduled = false;
+        bool m_isRollingShutter = false;
+        //! Source of physics steps on which rolling shutter slices are cast.
+        PhysicsBasedSource m_physicsStepSource;
+        PhysicsBasedSource::SourceEventHandlerType m_physicsStepHandler;
         std::shared_ptr<rclcpp::Publisher<sensor_msgs::msg::PointCloud2>> m_pointCloudPublisher;
+        PointCloudMessageBuilder m_pointCloudMessageBuilder;
+        //! Message reused between scans, so that its data buffer is allocated only when the scan grows.
+        sensor_msgs::msg::PointCloud2 m_pointCloudMessage;
 
         LidarCore m_lidarCore;
 
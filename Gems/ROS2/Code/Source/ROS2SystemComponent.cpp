@@ -22,13 +22,19 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/Time/ITime.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzFramework/API/ApplicationAPI.h>
+#include <ROS2/Utilities/ROS2Conversions.h>
 
 namespace ROS2
 {
     constexpr AZStd::string_view EnablePhysicsSteadyClockConfigurationKey = "/O3DE/ROS2/SteadyClock";
+    constexpr AZStd::string_view CameraFrameWorkerCountConfigurationKey = "/O3DE/ROS2/Camera/FrameWorkerCount";
+    constexpr AZStd::string_view CameraFrameQueueDepthConfigurationKey = "/O3DE/ROS2/Camera/FrameQueueDepth";
+    constexpr AZStd::string_view SensorLoadWindowStepsConfigurationKey = "/O3DE/ROS2/SensorScheduler/LoadWindowSteps";
+    constexpr AZStd::string_view SensorLoadLoggingConfigurationKey = "/O3DE/ROS2/SensorScheduler/LogLoad";
 
     void ROS2SystemComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -118,6 +124,30 @@ namespace ROS2
         m_simulationClock = AZStd::make_unique<SimulationClock>();
     }
 
+    void ROS2SystemComponent::InitCameraFrameWorkerPool()
+    {
+        AZ::u64 workerCount = CameraFrameWorkerPool::DefaultWorkerCount;
+        AZ::u64 queueDepth = CameraFrameWorkerPool::DefaultQueueDepth;
+        if (auto* registry = AZ::SettingsRegistry::Get())
+        {
+            registry->Get(workerCount, CameraFrameWorkerCountConfigurationKey);
+            registry->Get(queueDepth, CameraFrameQueueDepthConfigurationKey);
+        }
+        m_cameraFrameWorkerPool.Activate(aznumeric_cast<AZ::u32>(workerCount), aznumeric_cast<AZ::u32>(queueDepth));
+    }
+
+    void ROS2SystemComponent::InitSensorScheduler()
+    {
+        AZ::u64 loadWindowSteps = SensorScheduler::DefaultLoadWindowSteps;
+        bool logLoad = false;
+        if (auto* registry = AZ::SettingsRegistry::Get())
+        {
+            registry->Get(loadWindowSteps, SensorLoadWindowStepsConfigurationKey);
+            registry->Get(logLoad, SensorLoadLoggingConfigurationKey);
+        }
+        m_sensorScheduler.Activate(aznumeric_cast<AZ::u32>(loadWindowSteps), logLoad);
+    }
+
     void ROS2SystemComponent::InitPassTemplateMappingsHandler()
     {
         auto* passSystem = AZ::RPI::PassSystemInterface::Get();
@@ -141,6 +171,8 @@ namespace ROS2
 
         m_staticTFBroadcaster = AZStd::make_unique<tf2_ros::StaticTransformBroadcaster>(m_ros2Node);
         m_dynamicTFBroadcaster = AZStd::make_unique<tf2_ros::TransformBroadcaster>(m_ros2Node);
+        InitCameraFrameWorkerPool();
+        InitSensorScheduler();
 
         AZ::ApplicationTypeQuery appType;
         AZ::ComponentApplicationBus::Broadcast(&AZ::ComponentApplicationBus::Events::QueryApplicationType, appType);
@@ -159,8 +191,14 @@ namespace ROS2
         ROS2RequestBus::Handler::BusDisconnect();
         m_simulationClock->Deactivate();
         m_loadTemplatesHandler.Disconnect();
+        m_cameraFrameWorkerPool.Deactivate();
+        m_cameraSharedResources.Deactivate();
+        m_sensorScheduler.Deactivate();
         m_dynamicTFBroadcaster.reset();
         m_staticTFBroadcaster.reset();
+        m_dynamicTransformIds.clear();
+        m_dynamicTransformGetters.clear();
+        m_dynamicTransformMessages.clear();
         m_executor->remove_node(m_ros2Node);
         m_executor.reset();
         m_simulationClock.reset();
@@ -194,11 +232,67 @@ namespace ROS2
         }
     }
 
+    ROS2Requests::DynamicTransformId ROS2SystemComponent::RegisterDynamicTransform(
+        const AZStd::string& parentFrame, const AZStd::string& childFrame, DynamicTransformGetter getTransform)
+    {
+        geometry_msgs::msg::TransformStamped message;
+        message.header.frame_id = parentFrame.c_str();
+        message.child_frame_id = childFrame.c_str();
+
+        const DynamicTransformId transformId = m_nextDynamicTransformId++;
+        m_dynamicTransformIds.push_back(transformId);
+        m_dynamicTransformGetters.push_back(AZStd::move(getTransform));
+        m_dynamicTransformMessages.push_back(AZStd::move(message));
+        return transformId;
+    }
+
+    void ROS2SystemComponent::UnregisterDynamicTransform(DynamicTransformId transformId)
+    {
+        auto it = AZStd::find(m_dynamicTransformIds.begin(), m_dynamicTransformIds.end(), transformId);
+        if (it == m_dynamicTransformIds.end())
+        {
+            return;
+        }
+
+        // Swap with the last transform, so that removal does not shift the remaining ones.
+        const size_t index = AZStd::distance(m_dynamicTransformIds.begin(), it);
+        const size_t last = m_dynamicTransformIds.size() - 1;
+        if (index != last)
+        {
+            m_dynamicTransformIds[index] = m_dynamicTransformIds[last];
+            m_dynamicTransformGetters[index] = AZStd::move(m_dynamicTransformGetters[last]);
+            m_dynamicTransformMessages[index] = AZStd::move(m_dynamicTransformMessages[last]);
+        }
+        m_dynamicTransformIds.pop_back();
+        m_dynamicTransformGetters.pop_back();
+        m_dynamicTransformMessages.pop_back();
+    }
+
+    void ROS2SystemComponent::PublishDynamicTransforms()
+    {
+        if (m_dynamicTransformMessages.empty())
+        {
+            return;
+        }
+
+        const builtin_interfaces::msg::Time timestamp = GetROSTimestamp();
+        for (size_t i = 0; i < m_dynamicTransformMessages.size(); ++i)
+        {
+            const AZ::Transform transform = m_dynamicTransformGetters[i]();
+            geometry_msgs::msg::TransformStamped& message = m_dynamicTransformMessages[i];
+            message.header.stamp = timestamp;
+            message.transform.translation = ROS2Conversions::ToROS2Vector3(transform.GetTranslation());
+            message.transform.rotation = ROS2Conversions::ToROS2Quaternion(transform.GetRotation());
+        }
+        m_dynamicTFBroadcaster->sendTransform(m_dynamicTransformMessages);
+    }
+
     void ROS2SystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
         if (rclcpp::ok())
         {
             m_simulationClock->Tick();
+            PublishDynamicTransforms();
             m_executor->spin_some();
         }
     }
@@ -11,9 +11,12 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <Camera/CameraFrameWorkerPool.h>
+#include <Camera/CameraSharedResources.h>
 #include <Lidar/LidarSystem.h>
 #include <ROS2/Clock/SimulationClock.h>
 #include <ROS2/ROS2Bus.h>
+#include <Sensor/SensorScheduler.h>
 #include <builtin_interfaces/msg/time.hpp>
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
@@ -63,6 +66,9 @@ namespace ROS2
         std::shared_ptr<rclcpp::Node> GetNode() const override;
         builtin_interfaces::msg::Time GetROSTimestamp() const override;
         void BroadcastTransform(const geometry_msgs::msg::TransformStamped& t, bool isDynamic) const override;
+        DynamicTransformId RegisterDynamicTransform(
+            const AZStd::string& parentFrame, const AZStd::string& childFrame, DynamicTransformGetter getTransform) override;
+        void UnregisterDynamicTransform(DynamicTransformId transformId) override;
         const SimulationClock& GetSimulationClock() const override;
         //////////////////////////////////////////////////////////////////////////
 
@@ -82,12 +88,27 @@ namespace ROS2
         ////////////////////////////////////////////////////////////////////////
     private:
         void InitClock();
+        //! Start camera frame workers, configured through the settings registry.
+        void InitCameraFrameWorkerPool();
+        void InitSensorScheduler();
+        //! Publish all registered dynamic transforms in a single tf2 message.
+        void PublishDynamicTransforms();
 
         std::shared_ptr<rclcpp::Node> m_ros2Node;
         AZStd::shared_ptr<rclcpp::executors::SingleThreadedExecutor> m_executor;
         AZStd::unique_ptr<tf2_ros::TransformBroadcaster> m_dynamicTFBroadcaster;
         AZStd::unique_ptr<tf2_ros::StaticTransformBroadcaster> m_staticTFBroadcaster;
         AZStd::unique_ptr<SimulationClock> m_simulationClock;
+        CameraFrameWorkerPool m_cameraFrameWorkerPool;
+        CameraSharedResources m_cameraSharedResources;
+        SensorScheduler m_sensorScheduler;
+
+        //! Registered dynamic transforms. Ids, getters and messages are kept at the same indices.
+        AZStd::vector<DynamicTransformId> m_dynamicTransformIds;
+        AZStd::vector<DynamicTransformGetter> m_dynamicTransformGetters;
+        //! Messages of registered dynamic transforms, reused between ticks so that only stamps and transforms are updated.
+        std::vector<geometry_msgs::msg::TransformStamped> m_dynamicTransformMessages;
+        DynamicTransformId m_nextDynamicTransformId = 1;
         //! Load the pass templates of the ROS2 gem.
         void LoadPassTemplateMappings();
         AZ::RPI::PassSystemInterface::OnReadyLoadTemplatesEvent::Handler m_loadTemplatesHandler;
@@ -133,8 +133,12 @@ namespace ROS2
         // Read the SDF Settings from the Settings Registry into a local struct
         SdfAssetBuilderSettings sdfBuilderSettings;
         sdfBuilderSettings.LoadSettings();
+
+        // Index packages once for the whole import
+        const auto amentPackageIndex = Utils::CreateAmentPackageIndex(sdfBuilderSettings);
         // Set the parser config settings for URDF content
-        sdf::ParserConfig parserConfig = Utils::SDFormat::CreateSdfParserConfigFromSettings(sdfBuilderSettings, filePath);
+        sdf::ParserConfig parserConfig =
+            Utils::SDFormat::CreateSdfParserConfigFromSettings(sdfBuilderSettings, filePath, amentPackageIndex);
 
         auto parsedSdfOutcome = UrdfParser::ParseFromFile(filePath, parserConfig, sdfBuilderSettings);
         if (!parsedSdfOutcome)
@@ -155,7 +159,8 @@ namespace ROS2
         if (importAssetWithUrdf)
         {
             urdfAssetsMapping = AZStd::make_shared<Utils::UrdfAssetMap>(
-                Utils::CopyAssetForURDFAndCreateAssetMap(meshNames, filePath, collidersNames, visualNames, sdfBuilderSettings));
+                Utils::CopyAssetForURDFAndCreateAssetMap(
+                    meshNames, filePath, collidersNames, visualNames, sdfBuilderSettings, *amentPackageIndex));
         }
         bool allAssetProcessed = false;
         bool assetProcessorFailed = false;
@@ -89,8 +89,12 @@ namespace ROS2
             // Read the SDF Settings from PrefabMakerPage
             const SdfAssetBuilderSettings& sdfBuilderSettings = m_fileSelectPage->GetSdfAssetBuilderSettings();
 
+            // Index packages once for the whole import, so that packages installed since the previous import are found.
+            m_amentPackageIndex = Utils::CreateAmentPackageIndex(sdfBuilderSettings);
+
             // Set the parser config settings for URDF content
-            sdf::ParserConfig parserConfig = Utils::SDFormat::CreateSdfParserConfigFromSettings(sdfBuilderSettings, m_urdfPath);
+            sdf::ParserConfig parserConfig =
+                Utils::SDFormat::CreateSdfParserConfigFromSettings(sdfBuilderSettings, m_urdfPath, m_amentPackageIndex);
 
             if (Utils::IsFileXacro(m_urdfPath))
             {
@@ -246,12 +250,12 @@ namespace ROS2
             if (m_importAssetWithUrdf)
             {
                 m_urdfAssetsMapping = AZStd::make_shared<Utils::UrdfAssetMap>(Utils::CopyAssetForURDFAndCreateAssetMap(
-                    m_meshNames, m_urdfPath.String(), collidersNames, visualNames, sdfBuilderSettings, dirSuffix));
+                    m_meshNames, m_urdfPath.String(), collidersNames, visualNames, sdfBuilderSettings, *m_amentPackageIndex, dirSuffix));
             }
             else
             {
-                m_urdfAssetsMapping =
-                    AZStd::make_shared<Utils::UrdfAssetMap>(Utils::FindAssetsForUrdf(m_meshNames, m_urdfPath.String(), sdfBuilderSettings));
+                m_urdfAssetsMapping = AZStd::make_shared<Utils::UrdfAssetMap>(
+                    Utils::FindAssetsForUrdf(m_meshNames, m_urdfPath.String(), sdfBuilderSettings, *m_amentPackageIndex));
                 for (const AZStd::string& meshPath : m_meshNames)
                 {
                     if (m_urdfAssetsMapping->contains(meshPath))
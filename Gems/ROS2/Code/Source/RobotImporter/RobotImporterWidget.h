@@ -76,6 +76,8 @@ namespace ROS2
 
         /// mapping from urdf path to asset source
         AZStd::shared_ptr<Utils::UrdfAssetMap> m_urdfAssetsMapping;
+        //! Packages available in the AMENT_PREFIX_PATH, shared by all path resolutions of the import.
+        AZStd::shared_ptr<const Utils::AmentPackageIndex> m_amentPackageIndex;
         AZStd::unique_ptr<URDFPrefabMaker> m_prefabMaker;
         AZStd::unordered_set<AZStd::string> m_meshNames;
 
@@ -275,19 +275,22 @@ namespace ROS2
                 return;
             }
 
-            AZStd::string pxmodelPath = Utils::GetPhysXMeshProductAsset(asset->m_sourceGuid);
-            if (pxmodelPath.empty())
+            // Get asset product id (pxmesh), unless it was already resolved
+            AZ::Data::AssetId assetId = asset->m_physXMeshProductAssetId;
+            const AZ::Data::AssetType PhysxMeshAssetType = azrtti_typeid<PhysX::Pipeline::MeshAsset>();
+            if (!assetId.IsValid())
             {
-                AZ_Error(
-                    Internal::CollidersMakerLoggingTag, false, "Could not find pxmodel for %s", asset->m_sourceAssetGlobalPath.c_str());
-                return;
+                AZStd::string pxmodelPath = Utils::GetPhysXMeshProductAsset(asset->m_sourceGuid);
+                if (pxmodelPath.empty())
+                {
+                    AZ_Error(
+                        Internal::CollidersMakerLoggingTag, false, "Could not find pxmodel for %s", asset->m_sourceAssetGlobalPath.c_str());
+                    return;
+                }
+                AZ_Printf(Internal::CollidersMakerLoggingTag, "pxmodelPath  %s\n", pxmodelPath.c_str());
+                AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                    assetId, &AZ::Data::AssetCatalogRequests::GetAssetIdByPath, pxmodelPath.c_str(), PhysxMeshAssetType, true);
             }
-            AZ_Printf(Internal::CollidersMakerLoggingTag, "pxmodelPath  %s\n", pxmodelPath.c_str());
-            // Get asset product id (pxmesh)
-            AZ::Data::AssetId assetId;
-            const AZ::Data::AssetType PhysxMeshAssetType = azrtti_typeid<PhysX::Pipeline::MeshAsset>();
-            AZ::Data::AssetCatalogRequestBus::BroadcastResult(
-                assetId, &AZ::Data::AssetCatalogRequests::GetAssetIdByPath, pxmodelPath.c_str(), PhysxMeshAssetType, true);
             AZ_Printf(
                 Internal::CollidersMakerLoggingTag,
                 "Collider %s has assetId %s\n",
@@ -24,6 +24,7 @@
 #include <AzToolsFramework/ToolsComponents/TransformComponent.h>
 #include <ROS2/Frame/ROS2FrameComponent.h>
 #include <ROS2/ROS2GemUtilities.h>
+#include <ROS2/Utilities/ConcurrencyUtilities.h>
 #include <RobotControl/ROS2RobotControlComponent.h>
 #include <RobotImporter/Utils/RobotImporterUtils.h>
 #include <optional>
@@ -118,6 +119,69 @@ namespace ROS2
         Utils::VisitModels(*m_root, GetAssetsForLinkInModel, visitNestedModels);
     }
 
+    void URDFPrefabMaker::ResolveProductAssets()
+    {
+        if (!m_urdfAssetsMapping)
+        {
+            return;
+        }
+
+        // Each job updates a single entry of the mapping and no entries are added, so the jobs do not interfere.
+        AZStd::vector<Utils::AvailableAsset*> assets;
+        for (auto& [urdfPath, urdfAsset] : *m_urdfAssetsMapping)
+        {
+            if (!urdfAsset.m_availableAssetInfo.m_sourceGuid.IsNull())
+            {
+                assets.push_back(&urdfAsset.m_availableAssetInfo);
+            }
+        }
+
+        ConcurrencyUtilities::ForEachConcurrently(
+            assets.size(),
+            [&assets](size_t assetIndex)
+            {
+                Utils::AvailableAsset& asset = *assets[assetIndex];
+                asset.m_modelProductAssetId = Utils::GetModelProductAssetId(asset.m_sourceGuid);
+                asset.m_physXMeshProductAssetId = Utils::GetPhysXMeshProductAssetId(asset.m_sourceGuid);
+            });
+    }
+
+    URDFPrefabMaker::LinkPrefabDataMap URDFPrefabMaker::ComputeLinkPrefabData(
+        const AZStd::unordered_map<AZStd::string, const sdf::Link*>& links) const
+    {
+        AZStd::vector<AZStd::pair<AZStd::string, LinkPrefabData>> linksData;
+        linksData.reserve(links.size());
+        for (const auto& [linkName, linkPtr] : links)
+        {
+            LinkPrefabData linkData;
+            linkData.m_link = linkPtr;
+            linksData.emplace_back(linkName, AZStd::move(linkData));
+        }
+
+        // Lookups only read the parsed SDF document, so links are processed independently.
+        ConcurrencyUtilities::ForEachConcurrently(
+            linksData.size(),
+            [this, &linksData](size_t linkIndex)
+            {
+                auto& [linkName, linkData] = linksData[linkIndex];
+                linkData.m_worldTransform = Utils::GetWorldTransformURDF(linkData.m_link);
+                linkData.m_model = Utils::GetModelContainingLink(*m_root, *linkData.m_link);
+                if (linkData.m_model != nullptr)
+                {
+                    constexpr bool gatherNestedModelJoints = true;
+                    const AZStd::vector<const sdf::Joint*> jointsWhereLinkIsChild =
+                        Utils::GetJointsForChildLink(*linkData.m_model, linkName, gatherNestedModelJoints);
+                    if (!jointsWhereLinkIsChild.empty())
+                    {
+                        const std::string& parentName = jointsWhereLinkIsChild.front()->ParentName();
+                        linkData.m_parentLinkName = AZStd::string(parentName.c_str(), parentName.size());
+                    }
+                }
+            });
+
+        return LinkPrefabDataMap(AZStd::make_move_iterator(linksData.begin()), AZStd::make_move_iterator(linksData.end()));
+    }
+
     URDFPrefabMaker::CreatePrefabTemplateResult URDFPrefabMaker::CreatePrefabTemplateFromUrdfOrSdf()
     {
         {
@@ -149,9 +213,14 @@ namespace ROS2
         constexpr bool visitNestedModels = true;
         Utils::VisitModels(*m_root, GetAllLinksFromModel, visitNestedModels);
 
+        // The first phase resolves assets and computes data of links in parallel, as they are independent.
+        ResolveProductAssets();
+        const LinkPrefabDataMap linksData = ComputeLinkPrefabData(links);
+
+        // The second phase creates entities and components, which has to be done on this thread.
         for (const auto& [name, linkPtr] : links)
         {
-            createdLinks[name] = AddEntitiesForLink(linkPtr, AZ::EntityId{}, createdEntities);
+            createdLinks[name] = AddEntitiesForLink(linksData.at(name), AZ::EntityId{}, createdEntities);
         }
 
         for (const auto& [name, result] : createdLinks)
@@ -177,7 +246,7 @@ namespace ROS2
         {
             if (const auto thisEntry = createdLinks.at(name); thisEntry.IsSuccess())
             {
-                AZ::Transform tf = Utils::GetWorldTransformURDF(linkPtr);
+                const AZ::Transform& tf = linksData.at(name).m_worldTransform;
                 auto* entity = AzToolsFramework::GetEntityById(thisEntry.GetValue());
                 if (entity)
                 {
@@ -218,14 +287,8 @@ namespace ROS2
                 continue;
             }
 
-            AZStd::vector<const sdf::Joint*> jointsWhereLinkIsChild;
-            if (const sdf::Model* modelContainingLink = Utils::GetModelContainingLink(*m_root, *linkPtr); modelContainingLink != nullptr)
-            {
-                bool gatherNestedModelJoints = true;
-                jointsWhereLinkIsChild = Utils::GetJointsForChildLink(*modelContainingLink, linkName, gatherNestedModelJoints);
-            }
-
-            if (jointsWhereLinkIsChild.empty())
+            const AZStd::optional<AZStd::string>& parentLinkName = linksData.at(linkName).m_parentLinkName;
+            if (!parentLinkName.has_value())
             {
                 // emplace unique entry to the container of links that don't have a parent link associated with it
                 if (auto existingLinkIt =
@@ -251,8 +314,7 @@ namespace ROS2
                 > defining the coordinate transformation from the parent link frame to the child link frame.
             */
 
-            AZStd::string parentName(
-                jointsWhereLinkIsChild.front()->ParentName().c_str(), jointsWhereLinkIsChild.front()->ParentName().size());
+            const AZStd::string& parentName = *parentLinkName;
             const auto parentEntry = createdLinks.find(parentName);
             if (parentEntry == createdLinks.end())
             {
@@ -459,11 +521,12 @@ namespace ROS2
     }
 
     AzToolsFramework::Prefab::PrefabEntityResult URDFPrefabMaker::AddEntitiesForLink(
-        const sdf::Link* link, AZ::EntityId parentEntityId, AZStd::vector<AZ::EntityId>& createdEntities)
+        const LinkPrefabData& linkData, AZ::EntityId parentEntityId, AZStd::vector<AZ::EntityId>& createdEntities)
     {
+        const sdf::Link* link = linkData.m_link;
         if (!link)
         {
-            AZ::Failure(AZStd::string("Failed to create prefab entity - link is null"));
+            return AZ::Failure(AZStd::string("Failed to create prefab entity - link is null"));
         }
 
         auto createEntityResult = PrefabMakerUtils::CreateEntity(parentEntityId, link->Name().c_str());
@@ -486,8 +549,8 @@ namespace ROS2
         auto createdVisualEntities = m_visualsMaker.AddVisuals(link, entityId);
         createdEntities.insert(createdEntities.end(), createdVisualEntities.begin(), createdVisualEntities.end());
 
-        // Get the SDF model where this link is a child
-        const sdf::Model* modelContainingLink = Utils::GetModelContainingLink(*m_root, *link);
+        // The SDF model where this link is a child
+        const sdf::Model* modelContainingLink = linkData.m_model;
 
         if (!m_useArticulations)
         {
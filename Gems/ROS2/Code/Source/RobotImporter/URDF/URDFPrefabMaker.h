@@ -18,6 +18,7 @@
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string.h>
@@ -70,8 +71,25 @@ namespace ROS2
         AZStd::string GetStatus();
 
     private:
+        //! Link data which depends only on the parsed SDF and on the assets, so that it can be computed for all links in parallel
+        //! before any entity is created.
+        struct LinkPrefabData
+        {
+            const sdf::Link* m_link = nullptr;
+            const sdf::Model* m_model = nullptr; //!< Model containing the link, if any.
+            AZ::Transform m_worldTransform = AZ::Transform::CreateIdentity();
+            //! Parent link of the first joint where the link is a child, or nullopt if the link is not a child in any joint.
+            AZStd::optional<AZStd::string> m_parentLinkName;
+        };
+        using LinkPrefabDataMap = AZStd::unordered_map<AZStd::string, LinkPrefabData>;
+
+        //! Resolve product assets of all meshes referenced by the model, in parallel.
+        void ResolveProductAssets();
+        //! Compute data of all links, in parallel.
+        LinkPrefabDataMap ComputeLinkPrefabData(const AZStd::unordered_map<AZStd::string, const sdf::Link*>& links) const;
+
         AzToolsFramework::Prefab::PrefabEntityResult AddEntitiesForLink(
-            const sdf::Link* link, AZ::EntityId parentEntityId, AZStd::vector<AZ::EntityId>& createdEntities);
+            const LinkPrefabData& linkData, AZ::EntityId parentEntityId, AZStd::vector<AZ::EntityId>& createdEntities);
         void BuildAssetsForLink(const sdf::Link* link);
         void AddRobotControl(AZ::EntityId rootEntityId);
         static void MoveEntityToDefaultSpawnPoint(const AZ::EntityId& rootEntityId, AZStd::optional<AZ::Transform> spawnPosition);
@@ -174,7 +174,8 @@ namespace ROS2
                 AZ::Data::AssetId assetId;
                 if (asset)
                 {
-                    assetId = Utils::GetModelProductAssetId(asset->m_sourceGuid);
+                    assetId = asset->m_modelProductAssetId.IsValid() ? asset->m_modelProductAssetId
+                                                                     : Utils::GetModelProductAssetId(asset->m_sourceGuid);
                     AZ_Warning("AddVisual", assetId.IsValid(), "There is no product asset for %s.", asset->m_sourceAssetRelativePath.c_str());
                 }
 
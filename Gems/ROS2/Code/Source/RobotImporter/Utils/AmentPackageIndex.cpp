@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "AmentPackageIndex.h"
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <ROS2/Utilities/ConcurrencyUtilities.h>
+
+namespace ROS2::Utils
+{
+    namespace
+    {
+        //! Find packages in the share directory of a single prefix.
+        //! @returns names of subdirectories of @p amentSharePath which contain a package manifest.
+        AZStd::vector<AZStd::string> FindPackages(const AZ::IO::Path& amentSharePath)
+        {
+            AZStd::vector<AZStd::string> packageNames;
+            const AZ::IO::Path filter = amentSharePath / "*";
+            AZ::IO::SystemFile::FindFiles(
+                filter.c_str(),
+                [&packageNames, &amentSharePath](const char* fileName, bool isFile)
+                {
+                    const AZStd::string_view name(fileName);
+                    if (!isFile && name != "." && name != ".." &&
+                        AZ::IO::SystemFile::Exists((amentSharePath / name / "package.xml").c_str()))
+                    {
+                        packageNames.emplace_back(name);
+                    }
+                    return true;
+                });
+            return packageNames;
+        }
+    } // namespace
+
+    AmentPackageIndex::AmentPackageIndex(AZStd::string_view amentPrefixPath)
+        : m_amentPrefixPath(amentPrefixPath)
+    {
+    }
+
+    AmentPackageIndex::~AmentPackageIndex()
+    {
+        LogStatistics();
+    }
+
+    void AmentPackageIndex::ScanPrefixes() const
+    {
+        if (m_isScanned.load(AZStd::memory_order_acquire))
+        {
+            return;
+        }
+        AZStd::lock_guard<AZStd::mutex> lock(m_scanMutex);
+        if (m_isScanned.load(AZStd::memory_order_relaxed))
+        {
+            return;
+        }
+
+        const auto scanStartTime = AZStd::chrono::steady_clock::now();
+
+        // Note this code only works on Unix platforms, see ResolveAmentPrefixPath.
+        AZStd::vector<AZ::IO::Path> amentSharePaths;
+        AZ::StringFunc::TokenizeVisitor(
+            m_amentPrefixPath,
+            [&amentSharePaths](AZStd::string_view prefixPath)
+            {
+                amentSharePaths.push_back(AZ::IO::Path(prefixPath) / "share");
+            },
+            ':');
+        m_prefixCount = amentSharePaths.size();
+
+        // Each task lists a single prefix. Results are merged afterwards, to keep the AMENT_PREFIX_PATH order.
+        AZStd::vector<AZStd::vector<AZStd::string>> packagesPerPrefix(amentSharePaths.size());
+        ConcurrencyUtilities::ForEachConcurrently(
+            amentSharePaths.size(),
+            [&amentSharePaths, &packagesPerPrefix](size_t prefixIndex)
+            {
+                packagesPerPrefix[prefixIndex] = FindPackages(amentSharePaths[prefixIndex]);
+            });
+
+        for (size_t prefixIndex = 0; prefixIndex < amentSharePaths.size(); ++prefixIndex)
+        {
+            for (const auto& packageName : packagesPerPrefix[prefixIndex])
+            {
+                m_packageShareDirectories[packageName].push_back(amentSharePaths[prefixIndex]);
+            }
+        }
+
+        m_scanDuration = AZStd::chrono::duration<double>(AZStd::chrono::steady_clock::now() - scanStartTime).count();
+        AZ_Trace(
+            "AmentPackageIndex",
+            "Indexed %zu packages in %zu prefixes in %.3f s\n",
+            m_packageShareDirectories.size(),
+            m_prefixCount,
+            m_scanDuration);
+        m_isScanned.store(true, AZStd::memory_order_release);
+    }
+
+    const AZStd::vector<AZ::IO::Path>& AmentPackageIndex::GetPackageShareDirectories(AZStd::string_view packageName) const
+    {
+        static const AZStd::vector<AZ::IO::Path> NoShareDirectories;
+
+        ScanPrefixes();
+
+        auto packageIt = m_packageShareDirectories.find(AZStd::string(packageName));
+        if (packageIt == m_packageShareDirectories.end())
+        {
+            ++m_missCount;
+            return NoShareDirectories;
+        }
+        ++m_hitCount;
+        return packageIt->second;
+    }
+
+    const AZStd::string& AmentPackageIndex::GetAmentPrefixPath() const
+    {
+        return m_amentPrefixPath;
+    }
+
+    size_t AmentPackageIndex::GetHitCount() const
+    {
+        return m_hitCount;
+    }
+
+    size_t AmentPackageIndex::GetMissCount() const
+    {
+        return m_missCount;
+    }
+
+    void AmentPackageIndex::LogStatistics() const
+    {
+        if (!m_isScanned)
+        {
+            AZ_Printf("AmentPackageIndex", "No packages looked up, prefixes were not scanned\n");
+            return;
+        }
+
+        // Without the index, every lookup checks for the package manifest in each prefix until a match is found.
+        const size_t lookupCount = m_hitCount + m_missCount;
+        AZ_Printf(
+            "AmentPackageIndex",
+            "%zu packages indexed in %.3f s, %zu lookups: %zu hits, %zu misses, up to %zu package manifest probes avoided\n",
+            m_packageShareDirectories.size(),
+            m_scanDuration,
+            lookupCount,
+            m_hitCount.load(),
+            m_missCount.load(),
+            lookupCount * m_prefixCount);
+    }
+} // namespace ROS2::Utils
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace ROS2::Utils
+{
+    //! Index of ROS 2 packages installed in the directories listed in AMENT_PREFIX_PATH.
+    //! The `share` directory of every prefix is scanned once, on the first lookup, so that resolving
+    //! `package://` and `model://` URIs does not probe every prefix on disk for each referenced file.
+    //! An import session or asset builder job creates one index and passes it to everything resolving its paths;
+    //! prefixes are not scanned at all if nothing is looked up.
+    class AmentPackageIndex
+    {
+    public:
+        //! Create an index of the prefixes. Prefixes are scanned in parallel on the first lookup.
+        //! @param amentPrefixPath the string that contains available packages' path, separated by ':' signs.
+        explicit AmentPackageIndex(AZStd::string_view amentPrefixPath);
+
+        //! Logs lookup statistics.
+        ~AmentPackageIndex();
+
+        //! Get `<prefix>/share` directories of all prefixes which contain the package.
+        //! Scans the prefixes if this is the first lookup. It is safe to call from several threads.
+        //! @param packageName name of the package, as in `share/<packageName>/package.xml`.
+        //! @returns share directories in the AMENT_PREFIX_PATH order, empty if the package is not installed.
+        const AZStd::vector<AZ::IO::Path>& GetPackageShareDirectories(AZStd::string_view packageName) const;
+
+        //! Get the string this index was created from.
+        const AZStd::string& GetAmentPrefixPath() const;
+
+        //! Number of packages found in the index.
+        size_t GetHitCount() const;
+
+        //! Number of packages that were not found in the index.
+        size_t GetMissCount() const;
+
+        //! Log number of indexed packages, lookup hits and misses, and filesystem probes avoided by the index.
+        void LogStatistics() const;
+
+    private:
+        //! Scan all prefixes and fill the index, unless it is already filled.
+        void ScanPrefixes() const;
+
+        AZStd::string m_amentPrefixPath;
+        mutable AZStd::mutex m_scanMutex;
+        mutable AZStd::atomic_bool m_isScanned{ false };
+        mutable size_t m_prefixCount = 0;
+        mutable double m_scanDuration = 0.0; //!< Time spent scanning prefixes, in seconds.
+        mutable AZStd::unordered_map<AZStd::string, AZStd::vector<AZ::IO::Path>> m_packageShareDirectories;
+        mutable AZStd::atomic<size_t> m_hitCount{ 0 };
+        mutable AZStd::atomic<size_t> m_missCount{ 0 };
+    };
+} // namespace ROS2::Utils
@@ -12,6 +12,7 @@
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/regex.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzToolsFramework/API/EditorAssetSystemAPI.h>
@@ -508,23 +509,11 @@ namespace ROS2::Utils
         return resultModel;
     }
 
-    AZ::IO::Path ResolveAmentPrefixPath(
-        AZ::IO::Path unresolvedPath,
-        AZStd::string_view amentPrefixPath,
-        const FileExistsCB& fileExistsCB)
+    //! Strip the "model://" or "package://" prefix of the URI.
+    //! @returns path relative to the share directory of an ament prefix (e.g. 'ambulance/meshes/model.stl'),
+    //! or an empty path if the URI can't be resolved with AMENT_PREFIX_PATH.
+    AZ::IO::PathView StripAmentUriPrefix(const AZ::IO::Path& unresolvedPath)
     {
-        AZStd::vector<AZ::IO::Path> amentPrefixPaths;
-
-        // Parse the AMENT_PREFIX_PATH environment variable into a set of distinct paths.
-        auto AmentPrefixPathVisitor = [&amentPrefixPaths](
-            AZStd::string_view prefixPath)
-        {
-            amentPrefixPaths.push_back(prefixPath);
-        };
-        // Note this code only works on Unix platforms
-        // For Windows this will not work as the drive letter has a colon in it (C:\)
-        AZ::StringFunc::TokenizeVisitor(amentPrefixPath, AmentPrefixPathVisitor, ':');
-
         AZ::IO::PathView strippedPath;
 
         // The AMENT_PREFIX_PATH is only used for lookups if the URI starts with "model://" or "package://"
@@ -540,14 +529,34 @@ namespace ROS2::Utils
             }
         }
 
-        // If no valid prefix was found, or if the URI *only* contains the prefix, return an empty result.
-        if (strippedPath.empty())
+        // If the remaining path is an absolute path, it shouldn't get resolved with AMENT_PREFIX_PATH. return an empty result.
+        if (strippedPath.IsAbsolute())
         {
             return {};
         }
+        return strippedPath;
+    }
 
-        // If the remaining path is an absolute path, it shouldn't get resolved with AMENT_PREFIX_PATH. return an empty result.
-        if (strippedPath.IsAbsolute())
+    AZ::IO::Path ResolveAmentPrefixPath(
+        AZ::IO::Path unresolvedPath,
+        AZStd::string_view amentPrefixPath,
+        const FileExistsCB& fileExistsCB)
+    {
+        AZStd::vector<AZ::IO::Path> amentPrefixPaths;
+
+        // Parse the AMENT_PREFIX_PATH environment variable into a set of distinct paths.
+        auto AmentPrefixPathVisitor = [&amentPrefixPaths](
+            AZStd::string_view prefixPath)
+        {
+            amentPrefixPaths.push_back(prefixPath);
+        };
+        // Note this code only works on Unix platforms
+        // For Windows this will not work as the drive letter has a colon in it (C:\)
+        AZ::StringFunc::TokenizeVisitor(amentPrefixPath, AmentPrefixPathVisitor, ':');
+
+        // If no valid prefix was found, or if the URI *only* contains the prefix, return an empty result.
+        const AZ::IO::PathView strippedPath = StripAmentUriPrefix(unresolvedPath);
+        if (strippedPath.empty())
         {
             return {};
         }
@@ -577,27 +586,15 @@ namespace ROS2::Utils
         return {};
     }
 
-    /// Finds global path from URDF/SDF path
-    AZ::IO::Path ResolveAssetPath(
+    //! Resolves path for an asset referenced in a URDF/SDF file, using the URI prefix map, ancestor paths and the base file location.
+    AZ::IO::Path ResolveAssetPathWithoutAmentPrefixPath(
         AZ::IO::Path unresolvedPath,
         const AZ::IO::PathView& baseFilePath,
-        AZStd::string_view amentPrefixPath,
         const SdfAssetBuilderSettings& settings,
         const FileExistsCB& fileExistsCB)
     {
-        AZ_Printf("ResolveAssetPath", "ResolveAssetPath with %s\n", unresolvedPath.c_str());
-
         const auto& pathResolverSettings = settings.m_resolverSettings;
 
-        // If the settings tell us to try the AMENT_PREFIX_PATH, use that first to try and resolve path.
-        if (pathResolverSettings.m_useAmentPrefixPath)
-        {
-            if (AZ::IO::Path amentResolvedPath = ResolveAmentPrefixPath(unresolvedPath, amentPrefixPath, fileExistsCB); !amentResolvedPath.empty())
-            {
-                return amentResolvedPath;
-            }
-        }
-
         // Append all ancestor directories from the root file to the candidate replacement paths if the settings enable using
         // them for path resolution and the root file isn't empty.
         AZStd::vector<AZ::IO::Path> ancestorPaths;
@@ -711,6 +708,77 @@ namespace ROS2::Utils
             AZ_PATH_ARG(unresolvedPath), AZ_PATH_ARG(relativePath));
         return {};
     }
+
+    AZ::IO::Path ResolveAmentPackagePath(
+        const AZ::IO::Path& unresolvedPath,
+        const AmentPackageIndex& amentPackageIndex,
+        const FileExistsCB& fileExistsCB)
+    {
+        const AZ::IO::PathView strippedPath = StripAmentUriPrefix(unresolvedPath);
+        if (strippedPath.empty())
+        {
+            return {};
+        }
+
+        // Only share directories which contain the package manifest are indexed, so just the referenced file is checked.
+        const AZ::IO::PathView packageName = *strippedPath.begin();
+        for (const AZ::IO::Path& amentSharePath : amentPackageIndex.GetPackageShareDirectories(packageName.Native()))
+        {
+            if (const AZ::IO::Path candidateResolvedPath = amentSharePath / strippedPath; fileExistsCB(candidateResolvedPath))
+            {
+                AZ_Trace("ResolveAssetPath", R"(Resolved using AMENT_PREFIX_PATH: "%.*s" -> "%.*s")" "\n", 
+                    AZ_PATH_ARG(unresolvedPath), AZ_PATH_ARG(candidateResolvedPath));
+                return candidateResolvedPath;
+            }
+        }
+
+        // No resolution was found, return an empty result.
+        return {};
+    }
+
+    /// Finds global path from URDF/SDF path
+    AZ::IO::Path ResolveAssetPath(
+        AZ::IO::Path unresolvedPath,
+        const AZ::IO::PathView& baseFilePath,
+        AZStd::string_view amentPrefixPath,
+        const SdfAssetBuilderSettings& settings,
+        const FileExistsCB& fileExistsCB)
+    {
+        AZ_Printf("ResolveAssetPath", "ResolveAssetPath with %s\n", unresolvedPath.c_str());
+
+        // If the settings tell us to try the AMENT_PREFIX_PATH, use that first to try and resolve path.
+        if (settings.m_resolverSettings.m_useAmentPrefixPath)
+        {
+            if (AZ::IO::Path amentResolvedPath = ResolveAmentPrefixPath(unresolvedPath, amentPrefixPath, fileExistsCB);
+                !amentResolvedPath.empty())
+            {
+                return amentResolvedPath;
+            }
+        }
+        return ResolveAssetPathWithoutAmentPrefixPath(AZStd::move(unresolvedPath), baseFilePath, settings, fileExistsCB);
+    }
+
+    AZ::IO::Path ResolveAssetPath(
+        AZ::IO::Path unresolvedPath,
+        const AZ::IO::PathView& baseFilePath,
+        const AmentPackageIndex& amentPackageIndex,
+        const SdfAssetBuilderSettings& settings,
+        const FileExistsCB& fileExistsCB)
+    {
+        AZ_Printf("ResolveAssetPath", "ResolveAssetPath with %s\n", unresolvedPath.c_str());
+
+        // If the settings tell us to try the AMENT_PREFIX_PATH, use that first to try and resolve path.
+        if (settings.m_resolverSettings.m_useAmentPrefixPath)
+        {
+            if (AZ::IO::Path amentResolvedPath = ResolveAmentPackagePath(unresolvedPath, amentPackageIndex, fileExistsCB);
+                !amentResolvedPath.empty())
+            {
+                return amentResolvedPath;
+            }
+        }
+        return ResolveAssetPathWithoutAmentPrefixPath(AZStd::move(unresolvedPath), baseFilePath, settings, fileExistsCB);
+    }
+
     AmentPrefixString GetAmentPrefixPath()
     {
         // Support reading the AMENT_PREFIX_PATH environment variable on Unix/Windows platforms
@@ -726,6 +794,15 @@ namespace ROS2::Utils
         return amentPrefixPath;
     }
 
+    AZStd::shared_ptr<const AmentPackageIndex> CreateAmentPackageIndex(const SdfAssetBuilderSettings& settings)
+    {
+        if (!settings.m_resolverSettings.m_useAmentPrefixPath)
+        {
+            return AZStd::make_shared<const AmentPackageIndex>("");
+        }
+        return AZStd::make_shared<const AmentPackageIndex>(GetAmentPrefixPath());
+    }
+
 } // namespace ROS2::Utils
 
 namespace ROS2::Utils::SDFormat
@@ -780,6 +857,15 @@ namespace ROS2::Utils::SDFormat
 
     sdf::ParserConfig CreateSdfParserConfigFromSettings(const SdfAssetBuilderSettings& settings, const AZ::IO::PathView& baseFilePath)
     {
+        return CreateSdfParserConfigFromSettings(settings, baseFilePath, Utils::CreateAmentPackageIndex(settings));
+    }
+
+    sdf::ParserConfig CreateSdfParserConfigFromSettings(
+        const SdfAssetBuilderSettings& settings,
+        const AZ::IO::PathView& baseFilePath,
+        AZStd::shared_ptr<const AmentPackageIndex> amentPackageIndex)
+    {
+        AZ_Assert(amentPackageIndex, "Package index is required to resolve file paths");
         sdf::ParserConfig sdfConfig;
 
         sdfConfig.URDFSetPreserveFixedJoint(settings.m_urdfPreserveFixedJoints);
@@ -807,11 +893,9 @@ namespace ROS2::Utils::SDFormat
 
         // If any files couldn't be found using our supplied prefix mappings, this callback will get called.
         // Attempt to use our full path resolution, and print a warning if it still couldn't be resolved.
-        sdfConfig.SetFindCallback([settings, baseFilePath](const std::string &fileName) -> std::string
+        sdfConfig.SetFindCallback([settings, baseFilePath, amentPackageIndex](const std::string &fileName) -> std::string
         {
-            auto amentPrefixPath = Utils::GetAmentPrefixPath();
-
-            auto resolved = Utils::ResolveAssetPath(AZ::IO::Path(fileName.c_str()), baseFilePath, amentPrefixPath, settings);
+            auto resolved = Utils::ResolveAssetPath(AZ::IO::Path(fileName.c_str()), baseFilePath, *amentPackageIndex, settings);
             if (!resolved.empty())
             {
                 AZ_Trace("SdfParserConfig", "SDF SetFindCallback resolved '%s' -> '%s'", fileName.c_str(), resolved.c_str());
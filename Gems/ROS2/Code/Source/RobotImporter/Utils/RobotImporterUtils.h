@@ -16,6 +16,7 @@
 #include <AzCore/std/function/function_template.h>
 #include <AzCore/std/string/string.h>
 #include <RobotImporter/URDF/UrdfParser.h>
+#include <RobotImporter/Utils/AmentPackageIndex.h>
 #include <SdfAssetBuilder/SdfAssetBuilderSettings.h>
 
 #include <sdf/sdf.hh>
@@ -162,8 +163,27 @@ namespace ROS2::Utils
         const SdfAssetBuilderSettings& settings,
         const FileExistsCB& fileExists = &Internal::FileExistsCall);
 
+    //! Resolves path for an asset referenced in a URDF/SDF file, looking up `package://` and `model://` URIs in the package index.
+    //! @param unresolvedPath - unresolved URDF/SDF path, example : `model://meshes/foo.dae`.
+    //! @param baseFilePath - the absolute path of URDF/SDF file which contains the path that is to be resolved.
+    //! @param amentPackageIndex - index of packages available in the AMENT_PREFIX_PATH.
+    //! @param settings - the asset path resolution settings to use for attempting to locate the correct files
+    //! @param fileExists - functor to check if the given file exists. Exposed for unit test, default one should be used.
+    //! @returns resolved path to the referenced file within the URDF/SDF, or the passed-in path if no resolution was possible.
+    AZ::IO::Path ResolveAssetPath(
+        AZ::IO::Path unresolvedPath,
+        const AZ::IO::PathView& baseFilePath,
+        const AmentPackageIndex& amentPackageIndex,
+        const SdfAssetBuilderSettings& settings,
+        const FileExistsCB& fileExists = &Internal::FileExistsCall);
+
     using AmentPrefixString = AZStd::fixed_string<4096>;
     AmentPrefixString GetAmentPrefixPath();
+
+    //! Create the index of packages used to resolve paths with the given settings.
+    //! @param settings - the asset path resolution settings, which tell whether AMENT_PREFIX_PATH is used.
+    //! @returns index of packages available in the AMENT_PREFIX_PATH, or an empty index if the settings do not use it.
+    AZStd::shared_ptr<const AmentPackageIndex> CreateAmentPackageIndex(const SdfAssetBuilderSettings& settings);
 } // namespace ROS2::Utils
 
 namespace ROS2::Utils::SDFormat
@@ -193,4 +213,16 @@ namespace ROS2::Utils::SDFormat
     //! @return The output parser config to use with sdformat.
     sdf::ParserConfig CreateSdfParserConfigFromSettings(const SdfAssetBuilderSettings& settings, const AZ::IO::PathView& baseFilePath);
 
+    //! Given a set of SdfAssetBuilderSettings, produce an sdf::ParserConfig that can be used by the sdformat library.
+    //! Files not found with the URI prefix mappings are looked up in the given package index, which the parser config holds
+    //! for as long as it exists. Parsing several files with the same index avoids scanning AMENT_PREFIX_PATH for each of them.
+    //! @param settings The input settings to use
+    //! @param baseFilePath The base file getting parsed, which is used to help resolve file paths
+    //! @param amentPackageIndex Index of packages available in the AMENT_PREFIX_PATH
+    //! @return The output parser config to use with sdformat.
+    sdf::ParserConfig CreateSdfParserConfigFromSettings(
+        const SdfAssetBuilderSettings& settings,
+        const AZ::IO::PathView& baseFilePath,
+        AZStd::shared_ptr<const AmentPackageIndex> amentPackageIndex);
+
 } // namespace ROS2::Utils::SDFormat
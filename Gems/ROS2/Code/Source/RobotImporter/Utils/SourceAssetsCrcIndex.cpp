@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "SourceAssetsCrcIndex.h"
+#include "SourceAssetsStorage.h"
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/string/conversions.h>
+#include <ROS2/Utilities/ConcurrencyUtilities.h>
+
+namespace ROS2::Utils
+{
+    namespace
+    {
+        constexpr AZStd::string_view IndexFileHeader = "# ROS2 source assets CRC index v1: crc size modification_time path";
+
+        //! Files hashed by a single job on average. Each file costs a stat and a read of at most a kilobyte, so jobs are kept coarse.
+        constexpr size_t FilesPerJob = 64;
+    } // namespace
+
+    SourceAssetsCrcIndex::SourceAssetsCrcIndex(AZ::IO::Path indexFilePath)
+        : m_indexFilePath(AZStd::move(indexFilePath))
+    {
+    }
+
+    AZ::IO::Path SourceAssetsCrcIndex::GetDefaultIndexFilePath()
+    {
+        return AZ::IO::Path(AZ::Utils::GetProjectPath()) / "user" / "ROS2" / "SourceAssetsCrcIndex.txt";
+    }
+
+    bool SourceAssetsCrcIndex::Load()
+    {
+        m_entries.clear();
+        m_isDirty = false;
+
+        auto readOutcome = AZ::Utils::ReadFile<AZStd::string>(m_indexFilePath.Native());
+        if (!readOutcome.IsSuccess())
+        {
+            return false;
+        }
+
+        AZStd::vector<AZStd::string> lines;
+        AZ::StringFunc::Tokenize(readOutcome.GetValue(), lines, "\r\n");
+        if (lines.empty() || lines.front() != IndexFileHeader)
+        {
+            AZ_Warning("SourceAssetsCrcIndex", false, "Ignoring index with unknown format: %s", m_indexFilePath.c_str());
+            return false;
+        }
+
+        for (size_t lineIndex = 1; lineIndex < lines.size(); ++lineIndex)
+        {
+            // Path is the last field, as it may contain spaces.
+            const AZStd::string& line = lines[lineIndex];
+            const size_t crcEnd = line.find(' ');
+            const size_t sizeEnd = crcEnd == AZStd::string::npos ? crcEnd : line.find(' ', crcEnd + 1);
+            const size_t timeEnd = sizeEnd == AZStd::string::npos ? sizeEnd : line.find(' ', sizeEnd + 1);
+            if (timeEnd == AZStd::string::npos || timeEnd + 1 >= line.size())
+            {
+                AZ_Warning("SourceAssetsCrcIndex", false, "Ignoring malformed index entry: %s", line.c_str());
+                continue;
+            }
+
+            Entry entry;
+            entry.m_crc = AZ::Crc32(static_cast<AZ::u32>(AZStd::stoull(line.substr(0, crcEnd))));
+            entry.m_size = AZStd::stoull(line.substr(crcEnd + 1, sizeEnd - crcEnd - 1));
+            entry.m_modificationTime = AZStd::stoull(line.substr(sizeEnd + 1, timeEnd - sizeEnd - 1));
+            m_entries[AZ::IO::Path(line.substr(timeEnd + 1))] = entry;
+        }
+        return true;
+    }
+
+    bool SourceAssetsCrcIndex::Save()
+    {
+        const size_t erasedCount = AZStd::erase_if(
+            m_entries,
+            [](const auto& pathAndEntry)
+            {
+                return !pathAndEntry.second.m_isUsed;
+            });
+        if (!m_isDirty && erasedCount == 0)
+        {
+            return true;
+        }
+
+        AZStd::string content(IndexFileHeader);
+        content += '\n';
+        for (const auto& [path, entry] : m_entries)
+        {
+            content += AZStd::string::format(
+                "%u %llu %llu %s\n",
+                static_cast<AZ::u32>(entry.m_crc),
+                static_cast<unsigned long long>(entry.m_size),
+                static_cast<unsigned long long>(entry.m_modificationTime),
+                path.c_str());
+        }
+
+        auto writeOutcome = AZ::Utils::WriteFile(content, m_indexFilePath.Native());
+        if (!writeOutcome.IsSuccess())
+        {
+            AZ_Warning(
+                "SourceAssetsCrcIndex", false, "Cannot save index %s: %s", m_indexFilePath.c_str(), writeOutcome.GetError().c_str());
+            return false;
+        }
+        m_isDirty = false;
+        return true;
+    }
+
+    AZStd::vector<AZ::Crc32> SourceAssetsCrcIndex::GetFileCRCs(const AZStd::vector<AZ::IO::Path>& files)
+    {
+        AZStd::vector<AZ::Crc32> crcs(files.size());
+        AZStd::vector<Entry> fileStats(files.size());
+        AZStd::vector<size_t> missingFiles;
+
+        for (size_t fileIndex = 0; fileIndex < files.size(); ++fileIndex)
+        {
+            const char* filePath = files[fileIndex].c_str();
+            Entry& stat = fileStats[fileIndex];
+            stat.m_size = AZ::IO::SystemFile::Length(filePath);
+            stat.m_modificationTime = AZ::IO::SystemFile::ModificationTime(filePath);
+            stat.m_isUsed = true;
+
+            auto entryIt = m_entries.find(files[fileIndex]);
+            if (entryIt != m_entries.end() && entryIt->second.m_size == stat.m_size &&
+                entryIt->second.m_modificationTime == stat.m_modificationTime)
+            {
+                entryIt->second.m_isUsed = true;
+                crcs[fileIndex] = entryIt->second.m_crc;
+            }
+            else
+            {
+                missingFiles.push_back(fileIndex);
+            }
+        }
+
+        m_hitCount += files.size() - missingFiles.size();
+        m_missCount += missingFiles.size();
+        if (missingFiles.empty())
+        {
+            return crcs;
+        }
+
+        // Each task writes only the checksum of its own file, so no synchronization is needed.
+        const size_t maxJobCount = (missingFiles.size() + FilesPerJob - 1) / FilesPerJob;
+        ConcurrencyUtilities::ForEachConcurrently(
+            missingFiles.size(),
+            maxJobCount,
+            [&files, &missingFiles, &crcs](size_t missingFileIndex)
+            {
+                crcs[missingFiles[missingFileIndex]] = GetFileCRC(files[missingFiles[missingFileIndex]]);
+            });
+
+        for (const size_t fileIndex : missingFiles)
+        {
+            // Files that cannot be read are not indexed, so that they are retried on the next lookup.
+            if (crcs[fileIndex] == AZ::Crc32(0))
+            {
+                continue;
+            }
+            Entry& entry = m_entries[files[fileIndex]];
+            entry = fileStats[fileIndex];
+            entry.m_crc = crcs[fileIndex];
+        }
+        m_isDirty = true;
+        return crcs;
+    }
+
+    size_t SourceAssetsCrcIndex::GetHitCount() const
+    {
+        return m_hitCount;
+    }
+
+    size_t SourceAssetsCrcIndex::GetMissCount() const
+    {
+        return m_missCount;
+    }
+} // namespace ROS2::Utils
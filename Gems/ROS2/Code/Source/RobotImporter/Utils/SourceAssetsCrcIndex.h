@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace ROS2::Utils
+{
+    //! Persistent index of source asset checksums, as computed by `GetFileCRC`.
+    //! Entries are keyed by file path and validated with the file size and modification time, so that repeated imports
+    //! only rehash files that were added or changed since the index was last saved.
+    class SourceAssetsCrcIndex
+    {
+    public:
+        //! @param indexFilePath file the index is loaded from and saved to.
+        explicit SourceAssetsCrcIndex(AZ::IO::Path indexFilePath = GetDefaultIndexFilePath());
+
+        //! Default location of the index: a file in the user folder of the current project.
+        static AZ::IO::Path GetDefaultIndexFilePath();
+
+        //! Load entries saved by a previous session. A missing or malformed index file results in an empty index.
+        //! @returns true if the index file was read.
+        bool Load();
+
+        //! Save the index, if any entry changed since it was loaded.
+        //! Entries that were not looked up since loading are dropped, so files removed from the project do not accumulate.
+        //! @returns true if the index file is up to date.
+        bool Save();
+
+        //! Get checksums of the given files. Files that are not indexed or whose size or modification time changed
+        //! are hashed in parallel and their entries are updated.
+        //! @param files paths of files to get checksums of.
+        //! @returns checksums in the order of @p files. A zero checksum is returned for files that cannot be read.
+        AZStd::vector<AZ::Crc32> GetFileCRCs(const AZStd::vector<AZ::IO::Path>& files);
+
+        //! Number of checksums served from the index since construction.
+        size_t GetHitCount() const;
+
+        //! Number of checksums that had to be computed since construction.
+        size_t GetMissCount() const;
+
+    private:
+        struct Entry
+        {
+            AZ::u64 m_size = 0;
+            AZ::u64 m_modificationTime = 0;
+            AZ::Crc32 m_crc;
+            bool m_isUsed = false;
+        };
+
+        AZ::IO::Path m_indexFilePath;
+        AZStd::unordered_map<AZ::IO::Path, Entry> m_entries;
+        bool m_isDirty = false;
+        size_t m_hitCount = 0;
+        size_t m_missCount = 0;
+    };
+} // namespace ROS2::Utils
@@ -8,13 +8,16 @@
 
 #include "SourceAssetsStorage.h"
 #include "RobotImporterUtils.h"
+#include "SourceAssetsCrcIndex.h"
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/Utils/Utils.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Asset/AssetSystemBus.h>
 #include <AzToolsFramework/Asset/AssetUtils.h>
+#include <ROS2/Utilities/ConcurrencyUtilities.h>
 #include <SceneAPI/SceneCore/Containers/Scene.h>
 #include <SceneAPI/SceneCore/Containers/Utilities/Filters.h>
 #include <SceneAPI/SceneCore/DataTypes/GraphData/IMaterialData.h>
@@ -75,15 +78,13 @@ namespace ROS2::Utils
     /// Function computes CRC32 on first kilobyte of file.
     AZ::Crc32 GetFileCRC(const AZ::IO::Path& filename)
     {
+        AZStd::array<char, 1024> buffer; // limit crc computation to first kilobyte
         auto fileSize = AZ::IO::SystemFile::Length(filename.c_str());
-        fileSize = AZStd::min(fileSize, 1024ull); // limit crc computation to first kilobyte
+        fileSize = AZStd::min(fileSize, static_cast<AZ::u64>(buffer.size()));
         if (fileSize == 0)
         {
             return AZ::Crc32();
         }
-        AZStd::vector<char> buffer;
-        buffer.resize_no_construct(fileSize + 1);
-        buffer[fileSize] = '\0';
         if (!AZ::IO::SystemFile::Read(filename.c_str(), buffer.data(), fileSize))
         {
             return AZ::Crc32();
@@ -204,14 +205,14 @@ namespace ROS2::Utils
             AZ_Warning("GetInterestingSourceAssetsCRC", false, "Cannot open database");
             return {};
         }
-        auto callback = [&availableAssets](AzToolsFramework::AssetDatabase::SourceDatabaseEntry& entry)
+        // Collect source assets first, so that their checksums can be looked up in the index and computed in one batch.
+        AZStd::vector<AvailableAsset> foundAssets;
+        auto callback = [&foundAssets](AzToolsFramework::AssetDatabase::SourceDatabaseEntry& entry)
         {
             using AssetSysReqBus = AzToolsFramework::AssetSystemRequestBus;
             AvailableAsset foundAsset;
             foundAsset.m_sourceGuid = entry.m_sourceGuid;
 
-            using AssetSysReqBus = AzToolsFramework::AssetSystemRequestBus;
-
             // get source asset info
             bool sourceAssetFound{ false };
             AZ::Data::AssetInfo assetInfo;
@@ -228,13 +229,44 @@ namespace ROS2::Utils
 
             foundAsset.m_sourceAssetRelativePath = assetInfo.m_relativePath;
             foundAsset.m_sourceAssetGlobalPath = fullSourcePath.String();
+            foundAssets.push_back(AZStd::move(foundAsset));
+            return true;
+        };
+
+        for (auto& extension : InterestingExtensions)
+        {
+            assetDatabaseConnection.QuerySourceLikeSourceName(
+                extension.c_str(), AzToolsFramework::AssetDatabase::AssetDatabaseConnection::LikeType::EndsWith, callback);
+        }
 
-            AZ::Crc32 crc = Utils::GetFileCRC(foundAsset.m_sourceAssetGlobalPath);
+        AZStd::vector<AZ::IO::Path> sourcePaths;
+        sourcePaths.reserve(foundAssets.size());
+        for (const auto& foundAsset : foundAssets)
+        {
+            sourcePaths.emplace_back(foundAsset.m_sourceAssetGlobalPath);
+        }
+
+        // Only files that changed since the previous scan are rehashed.
+        SourceAssetsCrcIndex crcIndex;
+        crcIndex.Load();
+        const AZStd::vector<AZ::Crc32> crcs = crcIndex.GetFileCRCs(sourcePaths);
+        crcIndex.Save();
+        AZ_Printf(
+            "GetInterestingSourceAssetsCRC",
+            "Checksums of %zu source assets: %zu indexed, %zu computed",
+            foundAssets.size(),
+            crcIndex.GetHitCount(),
+            crcIndex.GetMissCount());
+
+        for (size_t assetIndex = 0; assetIndex < foundAssets.size(); ++assetIndex)
+        {
+            const AvailableAsset& foundAsset = foundAssets[assetIndex];
+            const AZ::Crc32 crc = crcs[assetIndex];
             if (crc == AZ::Crc32(0))
             {
                 AZ_Warning(
                     "GetInterestingSourceAssetsCRC", false, "Zero CRC for source asset %s", foundAsset.m_sourceAssetGlobalPath.c_str());
-                return true;
+                continue;
             }
             AZ_Printf("GetInterestingSourceAssetsCRC", "Found asset:");
             AZ_Printf("GetInterestingSourceAssetsCRC", "\tm_sourceAssetRelativePath  : %s", foundAsset.m_sourceAssetRelativePath.c_str());
@@ -258,16 +290,40 @@ namespace ROS2::Utils
             {
                 availableAssets.insert({ crc, foundAsset });
             }
-            return true;
+        }
+        return availableAssets;
+    }
+
+    namespace
+    {
+        constexpr AZStd::string_view MaxConcurrentAssetImportsConfigurationKey = "/O3DE/ROS2/RobotImporter/MaxConcurrentAssetImports";
+        constexpr AZ::u64 DefaultMaxConcurrentAssetImports = 4;
+
+        //! A mesh referenced by the robot description, copied to the project by CopyAssetForURDFAndCreateAssetMap.
+        struct MeshImport
+        {
+            AZStd::string m_unresolvedPath;
+            AZ::IO::Path m_resolvedPath;
+            AZ::IO::Path m_targetPathTmp;
+            AZ::IO::Path m_targetPathDst;
+            bool m_needsVisual = false;
+            bool m_needsCollider = false;
+            bool m_exists = false; //!< The mesh was imported before and is not copied again.
+            bool m_isCopied = false; //!< The mesh was copied to the temporary location.
+            bool m_hasAssetInfo = false; //!< The asset info of the copied mesh was created.
+            AZStd::vector<AZStd::pair<AZ::IO::Path, AZ::IO::Path>> m_textures; //!< Source and destination paths of mesh textures.
         };
 
-        for (auto& extension : InterestingExtensions)
+        AZ::u64 GetMaxConcurrentAssetImports()
         {
-            assetDatabaseConnection.QuerySourceLikeSourceName(
-                extension.c_str(), AzToolsFramework::AssetDatabase::AssetDatabaseConnection::LikeType::EndsWith, callback);
+            AZ::u64 maxConcurrentImports = DefaultMaxConcurrentAssetImports;
+            if (auto* registry = AZ::SettingsRegistry::Get())
+            {
+                registry->Get(maxConcurrentImports, MaxConcurrentAssetImportsConfigurationKey);
+            }
+            return AZStd::max(maxConcurrentImports, AZ::u64{ 1 });
         }
-        return availableAssets;
-    }
+    } // namespace
 
     UrdfAssetMap CopyAssetForURDFAndCreateAssetMap(
         const AZStd::unordered_set<AZStd::string>& meshesFilenames,
@@ -275,6 +331,7 @@ namespace ROS2::Utils
         const AZStd::unordered_set<AZStd::string>& colliders,
         const AZStd::unordered_set<AZStd::string>& visuals,
         const SdfAssetBuilderSettings& sdfBuilderSettings,
+        const AmentPackageIndex& amentPackageIndex,
         AZStd::string_view outputDirSuffix,
         AZ::IO::FileIOBase* fileIO)
     {
@@ -319,22 +376,20 @@ namespace ROS2::Utils
             }
             return urdfAssetMap;
         }
-        auto amentPrefixPath = Utils::GetAmentPrefixPath();
         AZStd::unordered_map<AZStd::string, unsigned int> countFilenames;
+        AZStd::vector<MeshImport> meshImports;
 
+        // Resolve paths and pick unique destination names. This is cheap and done serially, so that file names are deterministic.
         for (const auto& unresolvedUrfFileName : meshesFilenames)
         {
             auto resolvedPath =
-                Utils::ResolveAssetPath(unresolvedUrfFileName, AZ::IO::PathView(urdfFilename), amentPrefixPath, sdfBuilderSettings);
+                Utils::ResolveAssetPath(unresolvedUrfFileName, AZ::IO::PathView(urdfFilename), amentPackageIndex, sdfBuilderSettings);
             if (resolvedPath.empty())
             {
                 AZ_Warning("CopyAssetForURDF", false, "There is no resolved path for %s", unresolvedUrfFileName.c_str());
                 continue;
             }
 
-            const bool needsVisual = visuals.contains(unresolvedUrfFileName);
-            const bool needsCollider = colliders.contains(unresolvedUrfFileName);
-
             AZStd::string filename = resolvedPath.Filename().String();
             auto count = countFilenames[filename]++;
             if (count > 0)
@@ -344,93 +399,147 @@ namespace ROS2::Utils
                 filename = AZStd::string::format("%s_dup_%u%s", stem.c_str(), count, extension.c_str());
             }
 
-            AZ::IO::Path targetPathAssetDst(importDirectoryDst / filename);
-            AZ::IO::Path targetPathAssetTmp(importDirectoryTmp / filename);
+            MeshImport& meshImport = meshImports.emplace_back();
+            meshImport.m_unresolvedPath = unresolvedUrfFileName;
+            meshImport.m_resolvedPath = AZStd::move(resolvedPath);
+            meshImport.m_targetPathDst = importDirectoryDst / filename;
+            meshImport.m_targetPathTmp = importDirectoryTmp / filename;
+            meshImport.m_needsVisual = visuals.contains(unresolvedUrfFileName);
+            meshImport.m_needsCollider = colliders.contains(unresolvedUrfFileName);
+            meshImport.m_exists = fileIO->Exists(meshImport.m_targetPathDst.c_str());
+        }
 
-            AZ::IO::Path targetPathAssetInfo(targetPathAssetDst.Native() + ".assetinfo");
+        const size_t maxConcurrentImports = GetMaxConcurrentAssetImports();
 
-            if (!fileIO->Exists(targetPathAssetDst.c_str()))
+        // Copy meshes to the temporary location ignored by AP. Copies are independent of each other, so they run concurrently.
+        ConcurrencyUtilities::ForEachConcurrently(
+            meshImports.size(),
+            maxConcurrentImports,
+            [&](size_t meshIndex)
             {
-                // copy mesh file to temporary location ignored by AP
-                const auto outcomeCopyTmp = fileIO->Copy(resolvedPath.c_str(), targetPathAssetTmp.c_str());
+                MeshImport& meshImport = meshImports[meshIndex];
+                if (meshImport.m_exists)
+                {
+                    return;
+                }
+                const auto outcomeCopyTmp = fileIO->Copy(meshImport.m_resolvedPath.c_str(), meshImport.m_targetPathTmp.c_str());
                 AZ_Printf(
                     "CopyAssetForURDF",
                     "Copy %s to %s, result: %d",
-                    resolvedPath.c_str(),
-                    targetPathAssetTmp.c_str(),
+                    meshImport.m_resolvedPath.c_str(),
+                    meshImport.m_targetPathTmp.c_str(),
                     outcomeCopyTmp.GetResultCode());
-                if (outcomeCopyTmp)
-                {
-                    // create asset info at destination location using the temporary mesh file
-                    const bool assetInfoOk = CreateSceneManifest(targetPathAssetTmp, targetPathAssetInfo, needsCollider, needsVisual);
-
-                    if (assetInfoOk)
-                    {
-                        // copy additional assets such as textures directly to destination location
-                        const auto& meshTextureAssets = Utils::GetMeshTextureAssets(targetPathAssetTmp);
-                        for (const auto& unresolvedAssetPath : meshTextureAssets)
-                        {
-                            // Manifest returns local path in Project's directory temp folder
-                            const AZ::IO::Path assetLocalPath(AZ::IO::Path(AZ::IO::Path(AZ::Utils::GetProjectPath()) / unresolvedAssetPath)
-                                                                  .LexicallyRelative(importDirectoryTmp));
-
-                            const AZ::IO::Path assetFullPathSrc(AZ::IO::Path(resolvedPath.ParentPath()) / assetLocalPath);
-                            const AZ::IO::Path assetFullPathDst(importDirectoryDst / assetLocalPath);
-
-                            const auto outcomeMkdir = fileIO->CreatePath(AZ::IO::Path(assetFullPathDst.ParentPath()).c_str());
-                            if (!outcomeMkdir)
-                            {
-                                break;
-                            }
-
-                            const auto outcomeCopy = fileIO->Copy(assetFullPathSrc.c_str(), assetFullPathDst.c_str());
-                            if (outcomeCopy)
-                            {
-                                copiedFiles[assetFullPathSrc.String()] = assetFullPathDst.String();
-                            }
-                        }
-
-                        // move mesh file from temporary location to destination location
-                        const auto outcomeMoveDst = fileIO->Rename(targetPathAssetTmp.c_str(), targetPathAssetDst.c_str());
-                        AZ_Printf(
-                            "CopyAssetForURDF",
-                            "Rename file %s to %s, result: %d",
-                            targetPathAssetTmp.c_str(),
-                            targetPathAssetDst.c_str(),
-                            outcomeMoveDst.GetResultCode());
-
-                        // call GetAssetStatus_FlushIO to ensure the asset processor is aware of the new file
-                        AzFramework::AssetSystem::AssetStatus copiedAssetStatus =
-                            AzFramework::AssetSystem::AssetStatus::AssetStatus_Unknown;
-                        AzFramework::AssetSystemRequestBus::BroadcastResult(
-                            copiedAssetStatus,
-                            &AzFramework::AssetSystem::AssetSystemRequests::GetAssetStatus_FlushIO,
-                            targetPathAssetDst.c_str());
-                        AZ_Warning(
-                            "CopyAssetForURDF",
-                            copiedAssetStatus != AzFramework::AssetSystem::AssetStatus::AssetStatus_Unknown,
-                            "Asset processor did not recognize the new file %s.",
-                            targetPathAssetDst.c_str());
-
-                        if (outcomeMoveDst)
-                        {
-                            copiedFiles[unresolvedUrfFileName] = targetPathAssetDst.String();
-                        }
-                    }
-                }
+                meshImport.m_isCopied = static_cast<bool>(outcomeCopyTmp);
+            });
+
+        // Create asset info of copied meshes at destination location and find their textures. Both load the mesh scene,
+        // and the scene importer is not thread-safe, so this is done serially.
+        for (MeshImport& meshImport : meshImports)
+        {
+            if (!meshImport.m_isCopied)
+            {
+                continue;
             }
-            else
+
+            const AZ::IO::Path targetPathAssetInfo(meshImport.m_targetPathDst.Native() + ".assetinfo");
+            meshImport.m_hasAssetInfo =
+                CreateSceneManifest(meshImport.m_targetPathTmp, targetPathAssetInfo, meshImport.m_needsCollider, meshImport.m_needsVisual);
+            if (!meshImport.m_hasAssetInfo)
+            {
+                continue;
+            }
+
+            const auto& meshTextureAssets = Utils::GetMeshTextureAssets(meshImport.m_targetPathTmp);
+            for (const auto& unresolvedAssetPath : meshTextureAssets)
             {
-                AZ_Printf("CopyAssetForURDF", "File %s already exists, omitting import", targetPathAssetDst.c_str());
-                copiedFiles[unresolvedUrfFileName] = targetPathAssetDst.String();
+                // Manifest returns local path in Project's directory temp folder
+                const AZ::IO::Path assetLocalPath(
+                    AZ::IO::Path(AZ::IO::Path(AZ::Utils::GetProjectPath()) / unresolvedAssetPath).LexicallyRelative(importDirectoryTmp));
+                meshImport.m_textures.emplace_back(
+                    AZ::IO::Path(meshImport.m_resolvedPath.ParentPath()) / assetLocalPath, importDirectoryDst / assetLocalPath);
+            }
+        }
+
+        // Copy additional assets such as textures directly to destination location. Meshes often share textures,
+        // so each destination is copied once.
+        AZStd::unordered_map<AZ::IO::Path, AZ::IO::Path> textureCopies;
+        for (const auto& meshImport : meshImports)
+        {
+            for (const auto& [assetFullPathSrc, assetFullPathDst] : meshImport.m_textures)
+            {
+                textureCopies.emplace(assetFullPathDst, assetFullPathSrc);
+            }
+        }
+        AZStd::vector<AZStd::pair<AZ::IO::Path, AZ::IO::Path>> texturesToCopy;
+        for (const auto& [assetFullPathDst, assetFullPathSrc] : textureCopies)
+        {
+            if (fileIO->CreatePath(AZ::IO::Path(assetFullPathDst.ParentPath()).c_str()))
+            {
+                texturesToCopy.emplace_back(assetFullPathSrc, assetFullPathDst);
+            }
+        }
+        AZStd::vector<AZ::u8> isTextureCopied(texturesToCopy.size(), 0);
+        ConcurrencyUtilities::ForEachConcurrently(
+            texturesToCopy.size(),
+            maxConcurrentImports,
+            [&](size_t textureIndex)
+            {
+                const auto& [assetFullPathSrc, assetFullPathDst] = texturesToCopy[textureIndex];
+                isTextureCopied[textureIndex] = static_cast<bool>(fileIO->Copy(assetFullPathSrc.c_str(), assetFullPathDst.c_str()));
+            });
+        for (size_t textureIndex = 0; textureIndex < texturesToCopy.size(); ++textureIndex)
+        {
+            if (isTextureCopied[textureIndex])
+            {
+                copiedFiles[texturesToCopy[textureIndex].first.String()] = texturesToCopy[textureIndex].second;
+            }
+        }
+
+        // Move mesh files from temporary location to destination location, once all their textures are in place.
+        AZStd::vector<AZ::IO::Path> newSourceAssets;
+        for (const auto& meshImport : meshImports)
+        {
+            if (meshImport.m_exists)
+            {
+                AZ_Printf("CopyAssetForURDF", "File %s already exists, omitting import", meshImport.m_targetPathDst.c_str());
+                copiedFiles[meshImport.m_unresolvedPath] = meshImport.m_targetPathDst;
+            }
+            else if (meshImport.m_hasAssetInfo)
+            {
+                const auto outcomeMoveDst = fileIO->Rename(meshImport.m_targetPathTmp.c_str(), meshImport.m_targetPathDst.c_str());
+                AZ_Printf(
+                    "CopyAssetForURDF",
+                    "Rename file %s to %s, result: %d",
+                    meshImport.m_targetPathTmp.c_str(),
+                    meshImport.m_targetPathDst.c_str(),
+                    outcomeMoveDst.GetResultCode());
+                if (outcomeMoveDst)
+                {
+                    copiedFiles[meshImport.m_unresolvedPath] = meshImport.m_targetPathDst;
+                    newSourceAssets.push_back(meshImport.m_targetPathDst);
+                }
             }
 
             Utils::UrdfAsset asset;
             asset.m_urdfPath = urdfFilename;
-            asset.m_resolvedUrdfPath =
-                Utils::ResolveAssetPath(unresolvedUrfFileName, AZ::IO::PathView(urdfFilename), amentPrefixPath, sdfBuilderSettings);
+            asset.m_resolvedUrdfPath = meshImport.m_resolvedPath;
             asset.m_urdfFileCRC = AZ::Crc32();
-            urdfAssetMap.emplace(unresolvedUrfFileName, AZStd::move(asset));
+            urdfAssetMap.emplace(meshImport.m_unresolvedPath, AZStd::move(asset));
+        }
+
+        // Ensure the asset processor is aware of all new files. Flushing its IO once covers the whole batch,
+        // so the remaining files are only queried.
+        for (size_t assetIndex = 0; assetIndex < newSourceAssets.size(); ++assetIndex)
+        {
+            const auto getAssetStatus = assetIndex == 0 ? &AzFramework::AssetSystem::AssetSystemRequests::GetAssetStatus_FlushIO
+                                                        : &AzFramework::AssetSystem::AssetSystemRequests::GetAssetStatus;
+            AzFramework::AssetSystem::AssetStatus copiedAssetStatus = AzFramework::AssetSystem::AssetStatus::AssetStatus_Unknown;
+            AzFramework::AssetSystemRequestBus::BroadcastResult(copiedAssetStatus, getAssetStatus, newSourceAssets[assetIndex].Native());
+            AZ_Warning(
+                "CopyAssetForURDF",
+                copiedAssetStatus != AzFramework::AssetSystem::AssetStatus::AssetStatus_Unknown,
+                "Asset processor did not recognize the new file %s.",
+                newSourceAssets[assetIndex].c_str());
         }
 
         fileIO->DestroyPath(importDirectoryTmp.c_str());
@@ -453,17 +562,16 @@ namespace ROS2::Utils
     UrdfAssetMap FindAssetsForUrdf(
         const AZStd::unordered_set<AZStd::string>& meshesFilenames,
         const AZStd::string& urdfFilename,
-        const SdfAssetBuilderSettings& sdfBuilderSettings)
+        const SdfAssetBuilderSettings& sdfBuilderSettings,
+        const AmentPackageIndex& amentPackageIndex)
     {
-        auto amentPrefixPath = Utils::GetAmentPrefixPath();
-
         UrdfAssetMap urdfToAsset;
         for (const auto& t : meshesFilenames)
         {
             Utils::UrdfAsset asset;
             asset.m_urdfPath = t;
             asset.m_resolvedUrdfPath =
-                Utils::ResolveAssetPath(asset.m_urdfPath, AZ::IO::PathView(urdfFilename), amentPrefixPath, sdfBuilderSettings);
+                Utils::ResolveAssetPath(asset.m_urdfPath, AZ::IO::PathView(urdfFilename), amentPackageIndex, sdfBuilderSettings);
             asset.m_urdfFileCRC = Utils::GetFileCRC(asset.m_resolvedUrdfPath);
             urdfToAsset.emplace(t, AZStd::move(asset));
         }
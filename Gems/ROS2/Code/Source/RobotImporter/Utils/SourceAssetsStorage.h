@@ -26,6 +26,8 @@ namespace ROS2
 
 namespace ROS2::Utils
 {
+    class AmentPackageIndex;
+
     //! Structure contains essential information about the source and product assets in O3DE.
     //! It is designed to provide necessary information for other classes in URDF converter, eg CollidersMaker or VisualsMaker.
     struct AvailableAsset
@@ -41,6 +43,14 @@ namespace ROS2::Utils
 
         //! Source GUID of source asset
         AZ::Uuid m_sourceGuid = AZ::Uuid::CreateNull();
+
+        //! Id of AZ::RPI::ModelAsset product, resolved by URDFPrefabMaker before entities are created.
+        //! Invalid if not resolved yet or if there is no such product.
+        AZ::Data::AssetId m_modelProductAssetId;
+
+        //! Id of PhysX::Pipeline::MeshAsset product, resolved by URDFPrefabMaker before entities are created.
+        //! Invalid if not resolved yet or if there is no such product.
+        AZ::Data::AssetId m_physXMeshProductAssetId;
     };
 
     //! The structure contains a mapping between URDF's path to O3DE asset information.
@@ -66,6 +76,7 @@ namespace ROS2::Utils
     AZ::Crc32 GetFileCRC(const AZ::IO::Path& filename);
 
     //! Compute CRC for every source mesh from the assets catalog.
+    //! Checksums are kept in a persistent SourceAssetsCrcIndex, so only files changed since the previous call are read.
     //! @returns map where key is crc of source file and value is AvailableAsset.
     AZStd::unordered_map<AZ::Crc32, AvailableAsset> GetInterestingSourceAssetsCRC();
 
@@ -79,11 +90,13 @@ namespace ROS2::Utils
     //! @param meshesFilenames - list of the unresolved path from the URDF file
     //! @param urdfFilename - filename of URDF file, used for resolvement
     //! @param sdfBuilderSettings - the builder settings that should be used to resolve paths
+    //! @param amentPackageIndex - index of packages available in the AMENT_PREFIX_PATH, used to resolve paths
     //! @returns a URDF Asset map where the key is unresolved URDF path to AvailableAsset
     UrdfAssetMap FindAssetsForUrdf(
         const AZStd::unordered_set<AZStd::string>& meshesFilenames,
         const AZStd::string& urdfFilename,
-        const SdfAssetBuilderSettings& sdfBuilderSettings);
+        const SdfAssetBuilderSettings& sdfBuilderSettings,
+        const AmentPackageIndex& amentPackageIndex);
 
     //! Helper function that gives product's path from source asset GUID
     //! @param sourceAssetUUID is source asset GUID
@@ -136,12 +149,15 @@ namespace ROS2::Utils
 
     //! Copies and prepares meshes that are referenced in URDF.
     //! It resolves every mesh, creates a directory in Project's Asset directory, copies files, and prepares assets info.
+    //! Meshes and textures are copied concurrently, bounded by the /O3DE/ROS2/RobotImporter/MaxConcurrentAssetImports setting,
+    //! while assets info are created serially, and the Asset Processor is notified about all new files at once.
     //! Finally, it assembles its results into mapping that allows mapping Urdf's mesh name to the source asset.
     //! @param meshesFilenames - files to copy (as unresolved urdf paths)
     //! @param urdFilename - path to URDF file (as a global path)
     //! @param colliders - files to create collider assetinfo (as unresolved urdf paths)
     //! @param visuals - files to create visual assetinfo (as unresolved urdf paths)
     //! @param sdfBuilderSettings - the builder settings to use to convert the SDF/URDF files
+    //! @param amentPackageIndex - index of packages available in the AMENT_PREFIX_PATH, used to resolve paths
     //! @param outputDirSuffix - suffix to make output directory unique, if xacro file was used
     //! @param fileIO - instance to fileIO class
     //! @returns mapping from unresolved urdf paths to source asset info
@@ -151,6 +167,7 @@ namespace ROS2::Utils
         const AZStd::unordered_set<AZStd::string>& colliders,
         const AZStd::unordered_set<AZStd::string>& visual,
         const SdfAssetBuilderSettings& sdfBuilderSettings,
+        const AmentPackageIndex& amentPackageIndex,
         AZStd::string_view outputDirSuffix = "",
         AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance());
 
@@ -83,7 +83,8 @@ namespace ROS2
         // The AssetBuilderSDK doesn't support deregistration, so there's nothing more to do here.
     }
 
-    Utils::UrdfAssetMap SdfAssetBuilder::FindAssets(const sdf::Root& root, const AZStd::string& sourceFilename) const
+    Utils::UrdfAssetMap SdfAssetBuilder::FindAssets(
+        const sdf::Root& root, const AZStd::string& sourceFilename, const Utils::AmentPackageIndex& amentPackageIndex) const
     {
         AZ_Info(SdfAssetBuilderName, "Parsing mesh and collider names");
         auto assetNames = Utils::GetMeshesFilenames(root, true, true);
@@ -92,15 +93,13 @@ namespace ROS2
 
         using AssetSysReqBus = AzToolsFramework::AssetSystemRequestBus;
 
-        auto amentPrefixPath = Utils::GetAmentPrefixPath();
-
         for (const auto& uri : assetNames)
         {
             Utils::UrdfAsset asset;
             asset.m_urdfPath = uri;
 
             // Attempt to find the absolute path for the raw uri reference, which might look something like "model://meshes/model.dae"
-            asset.m_resolvedUrdfPath = Utils::ResolveAssetPath(asset.m_urdfPath, AZ::IO::PathView(sourceFilename), amentPrefixPath,
+            asset.m_resolvedUrdfPath = Utils::ResolveAssetPath(asset.m_urdfPath, AZ::IO::PathView(sourceFilename), amentPackageIndex,
                 m_globalSettings);
             if (asset.m_resolvedUrdfPath.empty())
             {
@@ -186,8 +185,12 @@ namespace ROS2
 
         const auto fullSourcePath = AZ::IO::Path(request.m_watchFolder) / AZ::IO::Path(request.m_sourceFile);
 
+        // Index packages once for the whole job, the index is used by the parser and when finding assets.
+        const auto amentPackageIndex = Utils::CreateAmentPackageIndex(m_globalSettings);
+
         // Set the parser config settings for parsing URDF content through the libsdformat parser
-        sdf::ParserConfig parserConfig = Utils::SDFormat::CreateSdfParserConfigFromSettings(m_globalSettings, fullSourcePath);
+        sdf::ParserConfig parserConfig =
+            Utils::SDFormat::CreateSdfParserConfigFromSettings(m_globalSettings, fullSourcePath, amentPackageIndex);
 
         AZ_Info(SdfAssetBuilderName, "Parsing source file: %s", fullSourcePath.c_str());
         auto parsedSdfRootOutcome = UrdfParser::ParseFromFile(fullSourcePath, parserConfig, m_globalSettings);
@@ -202,7 +205,7 @@ namespace ROS2
         const sdf::Root& sdfRoot = parsedSdfRootOutcome.GetRoot();
 
         AZ_Info(SdfAssetBuilderName, "Finding asset IDs for all mesh and collider assets.");
-        auto sourceAssetMap = AZStd::make_shared<Utils::UrdfAssetMap>(FindAssets(sdfRoot, fullSourcePath.String()));
+        auto sourceAssetMap = AZStd::make_shared<Utils::UrdfAssetMap>(FindAssets(sdfRoot, fullSourcePath.String(), *amentPackageIndex));
 
         // Create an output job for each platform
         for (const AssetBuilderSDK::PlatformInfo& platformInfo : request.m_enabledPlatforms)
@@ -247,8 +250,12 @@ namespace ROS2
         auto tempAssetOutputPath = AZ::IO::Path(request.m_tempDirPath) / request.m_sourceFile;
         tempAssetOutputPath.ReplaceExtension("procprefab");
 
+        // Index packages once for the whole job, the index is used by the parser and when finding assets.
+        const auto amentPackageIndex = Utils::CreateAmentPackageIndex(m_globalSettings);
+
         // Set the parser config settings for parsing URDF content through the libsdformat parser
-        sdf::ParserConfig parserConfig = Utils::SDFormat::CreateSdfParserConfigFromSettings(m_globalSettings, AZ::IO::PathView(request.m_sourceFile));
+        sdf::ParserConfig parserConfig = Utils::SDFormat::CreateSdfParserConfigFromSettings(
+            m_globalSettings, AZ::IO::PathView(request.m_sourceFile), amentPackageIndex);
 
         // Read in and parse the source SDF file.
         AZ_Info(SdfAssetBuilderName, "Parsing source file: %s", request.m_fullPath.c_str());
@@ -266,7 +273,7 @@ namespace ROS2
 
         // Resolve all the URI references into source asset GUIDs.
         AZ_Info(SdfAssetBuilderName, "Finding asset IDs for all mesh and collider assets.");
-        auto assetMap = AZStd::make_shared<Utils::UrdfAssetMap>(FindAssets(sdfRoot, request.m_fullPath));
+        auto assetMap = AZStd::make_shared<Utils::UrdfAssetMap>(FindAssets(sdfRoot, request.m_fullPath, *amentPackageIndex));
 
         // Given the parsed source file and asset mappings, generate an in-memory prefab.
         AZ_Info(SdfAssetBuilderName, "Creating prefab from source file.");
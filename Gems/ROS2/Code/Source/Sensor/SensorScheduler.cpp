@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+#include <AzFramework/Physics/Configuration/SystemConfiguration.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
+#include <Sensor/SensorScheduler.h>
+
+namespace ROS2
+{
+    namespace
+    {
+        AZ::u32 GreatestCommonDivisor(AZ::u32 a, AZ::u32 b)
+        {
+            while (b != 0)
+            {
+                const AZ::u32 remainder = a % b;
+                a = b;
+                b = remainder;
+            }
+            return a;
+        }
+    } // namespace
+
+    SensorScheduler::SensorScheduler()
+    {
+        if (!SensorSchedulerInterface::Get())
+        {
+            SensorSchedulerInterface::Register(this);
+        }
+    }
+
+    SensorScheduler::~SensorScheduler()
+    {
+        if (SensorSchedulerInterface::Get() == this)
+        {
+            SensorSchedulerInterface::Unregister(this);
+        }
+    }
+
+    void SensorScheduler::Activate(AZ::u32 loadWindowSteps, bool logLoad)
+    {
+        m_loadWindowSteps = AZStd::max(loadWindowSteps, 1u);
+        m_logLoad = logLoad;
+        m_onSceneSimulationStartHandler = AzPhysics::SceneEvents::OnSceneSimulationStartHandler(
+            [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
+            {
+                OnSceneSimulationStart(fixedDeltaTime);
+            });
+        m_active = true;
+    }
+
+    void SensorScheduler::Deactivate()
+    {
+        m_active = false;
+        m_onSceneSimulationStartHandler.Disconnect();
+        m_scheduledSensors.clear();
+        m_currentStepPublications = 0;
+        m_windowStatistics = {};
+        m_lastStatistics = {};
+    }
+
+    AZ::u32 SensorScheduler::SelectPhaseOffset(AZ::u32 period, const AZStd::vector<SchedulePhase>& scheduled)
+    {
+        AZ_Assert(period > 0, "Sensor period has to be at least one physics step.");
+        AZ::u32 bestOffset = 0;
+        double bestCollisionRate = AZStd::numeric_limits<double>::max();
+        for (AZ::u32 offset = 0; offset < period && bestCollisionRate > 0.0; ++offset)
+        {
+            // Expected fraction of steps on which the new sensor publishes together with one of the scheduled sensors.
+            double collisionRate = 0.0;
+            for (const SchedulePhase& phase : scheduled)
+            {
+                const AZ::u32 divisor = GreatestCommonDivisor(period, phase.m_period);
+                if (offset % divisor == phase.m_offset % divisor)
+                {
+                    const double leastCommonMultiple = static_cast<double>(period / divisor) * phase.m_period;
+                    collisionRate += 1.0 / leastCommonMultiple;
+                }
+            }
+
+            if (collisionRate < bestCollisionRate)
+            {
+                bestCollisionRate = collisionRate;
+                bestOffset = offset;
+            }
+        }
+        return bestOffset;
+    }
+
+    SensorScheduleId SensorScheduler::RegisterSensor(float frequency)
+    {
+        if (!m_active || !ConnectToPhysicsScene())
+        {
+            return InvalidSensorScheduleId;
+        }
+
+        const SensorScheduleId sensorId = m_nextSensorId++;
+        AssignPhase(sensorId, m_scheduledSensors[sensorId], frequency);
+        return sensorId;
+    }
+
+    void SensorScheduler::UnregisterSensor(SensorScheduleId sensorId)
+    {
+        m_scheduledSensors.erase(sensorId);
+        if (m_scheduledSensors.empty())
+        {
+            m_onSceneSimulationStartHandler.Disconnect();
+        }
+    }
+
+    void SensorScheduler::SetSensorFrequency(SensorScheduleId sensorId, float frequency)
+    {
+        if (auto sensorIt = m_scheduledSensors.find(sensorId); sensorIt != m_scheduledSensors.end())
+        {
+            AssignPhase(sensorId, sensorIt->second, frequency);
+        }
+    }
+
+    bool SensorScheduler::IsSensorRegistered(SensorScheduleId sensorId) const
+    {
+        return m_scheduledSensors.contains(sensorId);
+    }
+
+    bool SensorScheduler::IsPublicationDeadline(SensorScheduleId sensorId)
+    {
+        auto sensorIt = m_scheduledSensors.find(sensorId);
+        if (sensorIt == m_scheduledSensors.end())
+        {
+            return false;
+        }
+
+        ScheduledSensor& sensor = sensorIt->second;
+        if (m_currentStep < sensor.m_nextDueStep)
+        {
+            return false;
+        }
+
+        ++m_currentStepPublications;
+        sensor.m_nextDueStep += sensor.m_phase.m_period;
+        if (sensor.m_nextDueStep <= m_currentStep)
+        { // The sensor was not asked for more than a period (e.g. frame took several physics steps), skip missed publications.
+            sensor.m_nextDueStep = GetNextAlignedStep(sensor.m_phase);
+        }
+        return true;
+    }
+
+    SensorLoadStatistics SensorScheduler::GetLoadStatistics() const
+    {
+        return m_lastStatistics;
+    }
+
+    bool SensorScheduler::ConnectToPhysicsScene()
+    {
+        if (m_onSceneSimulationStartHandler.IsConnected())
+        {
+            return true;
+        }
+
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if (!sceneInterface)
+        {
+            return false;
+        }
+        AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+        if (sceneHandle == AzPhysics::InvalidSceneHandle)
+        {
+            return false;
+        }
+
+        if (auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get())
+        {
+            const auto* physicsConfiguration = physicsSystem->GetConfiguration();
+            if (physicsConfiguration && physicsConfiguration->m_fixedTimestep > 0.0f)
+            {
+                m_stepDuration = physicsConfiguration->m_fixedTimestep;
+            }
+        }
+        sceneInterface->RegisterSceneSimulationStartHandler(sceneHandle, m_onSceneSimulationStartHandler);
+        return true;
+    }
+
+    void SensorScheduler::OnSceneSimulationStart(float fixedDeltaTime)
+    {
+        if (m_currentStep > 0)
+        {
+            CommitStepLoad();
+        }
+        if (fixedDeltaTime > 0.0f)
+        {
+            m_stepDuration = fixedDeltaTime;
+        }
+        ++m_currentStep;
+    }
+
+    void SensorScheduler::CommitStepLoad()
+    {
+        m_windowStatistics.m_stepCount++;
+        m_windowStatistics.m_publicationCount += m_currentStepPublications;
+        m_windowStatistics.m_maxPublicationsPerStep = AZStd::max(m_windowStatistics.m_maxPublicationsPerStep, m_currentStepPublications);
+        m_currentStepPublications = 0;
+        if (m_windowStatistics.m_stepCount < m_loadWindowSteps)
+        {
+            return;
+        }
+
+        m_windowStatistics.m_meanPublicationsPerStep =
+            aznumeric_cast<float>(m_windowStatistics.m_publicationCount) / aznumeric_cast<float>(m_windowStatistics.m_stepCount);
+        m_windowStatistics.m_scheduledSensorCount = aznumeric_cast<AZ::u32>(m_scheduledSensors.size());
+        m_lastStatistics = m_windowStatistics;
+        m_windowStatistics = {};
+
+        if (m_logLoad)
+        {
+            AZ_Printf(
+                "SensorScheduler",
+                "Sensor load over %llu physics steps: %.2f mean and %u max publications per step, %u sensors scheduled\n",
+                m_lastStatistics.m_stepCount,
+                m_lastStatistics.m_meanPublicationsPerStep,
+                m_lastStatistics.m_maxPublicationsPerStep,
+                m_lastStatistics.m_scheduledSensorCount);
+        }
+    }
+
+    AZ::u32 SensorScheduler::GetPeriodInSteps(float frequency) const
+    {
+        // Same as ROS2::EventSourceAdapter, non-positive frequency is assumed to be 1Hz.
+        const float period = frequency > 0.0f ? 1.0f / frequency : 1.0f;
+        return AZStd::max(aznumeric_cast<AZ::u32>(AZStd::round(period / m_stepDuration)), 1u);
+    }
+
+    void SensorScheduler::AssignPhase(SensorScheduleId sensorId, ScheduledSensor& sensor, float frequency)
+    {
+        AZStd::vector<SchedulePhase> scheduled;
+        scheduled.reserve(m_scheduledSensors.size());
+        for (const auto& [otherSensorId, otherSensor] : m_scheduledSensors)
+        {
+            if (otherSensorId != sensorId)
+            {
+                scheduled.push_back(otherSensor.m_phase);
+            }
+        }
+
+        sensor.m_phase.m_period = GetPeriodInSteps(frequency);
+        sensor.m_phase.m_offset = SelectPhaseOffset(sensor.m_phase.m_period, scheduled);
+        sensor.m_nextDueStep = GetNextAlignedStep(sensor.m_phase);
+    }
+
+    AZ::u64 SensorScheduler::GetNextAlignedStep(const SchedulePhase& phase) const
+    {
+        const AZ::u64 step = m_currentStep + 1;
+        return step + (phase.m_offset + phase.m_period - step % phase.m_period) % phase.m_period;
+    }
+} // namespace ROS2
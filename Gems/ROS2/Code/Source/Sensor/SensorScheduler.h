@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <ROS2/Sensor/SensorSchedulerBus.h>
+
+namespace ROS2
+{
+    //! Scene-wide scheduler of sensor publications aligned to physics steps.
+    //! The scheduler counts steps of the default physics scene and converts frequency of each registered sensor to a period in steps.
+    //! Each sensor is assigned a phase offset within its period that collides least with sensors already scheduled, so that e.g. ten
+    //! 10Hz sensors in a 60Hz simulation publish on different steps instead of all on the same one. Publications are counted per step
+    //! to measure how evenly the load is distributed.
+    class SensorScheduler : public SensorSchedulerRequests
+    {
+    public:
+        AZ_RTTI(SensorScheduler, "{b3e81c5d-47a2-4f96-8d0b-c29e6a1f7d44}", SensorSchedulerRequests);
+
+        //! Period and phase offset of a scheduled sensor, both in physics steps.
+        struct SchedulePhase
+        {
+            AZ::u32 m_period = 1;
+            AZ::u32 m_offset = 0;
+        };
+
+        static constexpr AZ::u32 DefaultLoadWindowSteps = 600;
+
+        SensorScheduler();
+        virtual ~SensorScheduler();
+
+        //! Starts scheduling sensors.
+        //! @param loadWindowSteps Number of physics steps over which the publication load is measured.
+        //! @param logLoad Whether the measured load is printed at the end of each window.
+        void Activate(AZ::u32 loadWindowSteps = DefaultLoadWindowSteps, bool logLoad = false);
+        //! Stops scheduling and unregisters all sensors.
+        void Deactivate();
+
+        //! Selects a phase offset for a sensor with the given period that minimizes the expected number of sensors publishing on the
+        //! same physics step. Sensors with periods P and Q and offsets a and b meet once every lcm(P, Q) steps if a and b are equal
+        //! modulo gcd(P, Q), and never otherwise.
+        //! @param period Period of the new sensor in physics steps.
+        //! @param scheduled Periods and offsets of sensors already scheduled.
+        //! @return Phase offset in range [0, period).
+        static AZ::u32 SelectPhaseOffset(AZ::u32 period, const AZStd::vector<SchedulePhase>& scheduled);
+
+        // SensorSchedulerRequests overrides
+        SensorScheduleId RegisterSensor(float frequency) override;
+        void UnregisterSensor(SensorScheduleId sensorId) override;
+        void SetSensorFrequency(SensorScheduleId sensorId, float frequency) override;
+        bool IsSensorRegistered(SensorScheduleId sensorId) const override;
+        bool IsPublicationDeadline(SensorScheduleId sensorId) override;
+        SensorLoadStatistics GetLoadStatistics() const override;
+
+    protected:
+        //! Connects to the default physics scene, if not connected yet. Virtual, so that tests can schedule sensors without a scene.
+        //! @return Whether the scheduler is connected to the default physics scene.
+        virtual bool ConnectToPhysicsScene();
+        //! Starts the next physics step, committing the publication load of the previous one.
+        //! @param fixedDeltaTime Duration of the physics step in seconds.
+        void OnSceneSimulationStart(float fixedDeltaTime);
+
+    private:
+        struct ScheduledSensor
+        {
+            SchedulePhase m_phase;
+            AZ::u64 m_nextDueStep = 0;
+        };
+
+        void CommitStepLoad();
+
+        AZ::u32 GetPeriodInSteps(float frequency) const;
+        //! Assigns a phase offset to the sensor and schedules its first publication after the current step.
+        void AssignPhase(SensorScheduleId sensorId, ScheduledSensor& sensor, float frequency);
+        AZ::u64 GetNextAlignedStep(const SchedulePhase& phase) const;
+
+        bool m_active = false;
+        AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_onSceneSimulationStartHandler;
+
+        AZStd::unordered_map<SensorScheduleId, ScheduledSensor> m_scheduledSensors;
+        SensorScheduleId m_nextSensorId = InvalidSensorScheduleId + 1;
+
+        float m_stepDuration = 1.0f / 60.0f; ///< Duration of a physics step in seconds.
+        AZ::u64 m_currentStep = 0; ///< Number of physics steps started since the scheduler was connected.
+        AZ::u32 m_currentStepPublications = 0; ///< Number of publications within the current step.
+
+        AZ::u32 m_loadWindowSteps = DefaultLoadWindowSteps;
+        bool m_logLoad = false;
+        SensorLoadStatistics m_windowStatistics; ///< Load accumulated over the current window.
+        SensorLoadStatistics m_lastStatistics; ///< Load measured over the last complete window.
+    };
+} // namespace ROS2
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/weak_ptr.h>
+
+namespace ROS2
+{
+    //! Cache of resources shared by their users, e.g. ray directions of lidars using the same template.
+    //! The cache holds resources weakly: a resource is released when its last user releases it, and the expired entry is pruned
+    //! on the next lookup. The cache has to be owned by an object with a well defined lifetime (e.g. a system component), which
+    //! clears it on deactivation, so that no entries outlive the allocators.
+    //! Keys are compared with operator==, the cache is meant for a handful of entries.
+    template<typename KeyType, typename ResourceType>
+    class SharedResourceCache
+    {
+    public:
+        using ResourcePtr = AZStd::shared_ptr<ResourceType>;
+        using Factory = AZStd::function<ResourcePtr()>;
+
+        SharedResourceCache() = default;
+        SharedResourceCache(const SharedResourceCache&) = delete;
+        SharedResourceCache& operator=(const SharedResourceCache&) = delete;
+
+        //! Get the resource for the key, creating it if no user holds it anymore.
+        //! @param key Key of the resource.
+        //! @param factory Function creating the resource, called with the cache locked.
+        //! @return Resource shared with other users of the key.
+        ResourcePtr GetOrCreate(const KeyType& key, const Factory& factory)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            AZStd::erase_if(
+                m_entries,
+                [](const Entry& entry)
+                {
+                    return entry.m_resource.expired();
+                });
+
+            for (const Entry& entry : m_entries)
+            {
+                if (entry.m_key == key)
+                {
+                    if (auto resource = entry.m_resource.lock())
+                    {
+                        return resource;
+                    }
+                }
+            }
+
+            ResourcePtr resource = factory();
+            if (resource)
+            {
+                m_entries.push_back({ key, resource });
+            }
+            return resource;
+        }
+
+        //! Forget all entries. Resources still held by their users stay valid, but are no longer shared with new users.
+        void Clear()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_entries = {};
+        }
+
+        //! Get the number of entries, including expired entries not pruned yet.
+        size_t GetEntryCount() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return m_entries.size();
+        }
+
+    private:
+        struct Entry
+        {
+            KeyType m_key;
+            AZStd::weak_ptr<ResourceType> m_resource;
+        };
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<Entry> m_entries;
+    };
+} // namespace ROS2
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UnitTest/Utils.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzTest/AzTest.h>
+#include <RobotImporter/Utils/AmentPackageIndex.h>
+#include <RobotImporter/Utils/RobotImporterUtils.h>
+#include <SdfAssetBuilder/SdfAssetBuilderSettings.h>
+
+namespace UnitTest
+{
+    class AmentPackageIndexTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            // Prefixes are scanned in jobs.
+            AZ::JobManagerDesc jobManagerDesc;
+            jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+
+            // Package "foo" is installed in both prefixes, "bar" only in the second one.
+            // The "docs" directory has no package manifest, so it is not a package.
+            WriteTestFile("first/share/foo/package.xml");
+            WriteTestFile("second/share/foo/package.xml");
+            WriteTestFile("second/share/bar/package.xml");
+            WriteTestFile("second/share/bar/meshes/bar.dae");
+            WriteTestFile("second/share/docs/index.html");
+        }
+
+        void TearDown() override
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZ::IO::Path GetPath(AZStd::string_view relativePath) const
+        {
+            return AZ::IO::Path(m_temporaryDirectory.GetDirectory()) / relativePath;
+        }
+
+        //! AMENT_PREFIX_PATH with both test prefixes and a prefix that does not exist.
+        AZStd::string GetAmentPrefixPath() const
+        {
+            return AZStd::string::format("%s:%s:%s", GetPath("first").c_str(), GetPath("missing").c_str(), GetPath("second").c_str());
+        }
+
+        ROS2::SdfAssetBuilderSettings GetTestSettings() const
+        {
+            ROS2::SdfAssetBuilderSettings settings;
+            settings.m_resolverSettings.m_useAmentPrefixPath = true;
+            settings.m_resolverSettings.m_useAncestorPaths = false;
+            return settings;
+        }
+
+        void WriteTestFile(AZStd::string_view relativePath) const
+        {
+            EXPECT_TRUE(AZ::Utils::WriteFile("test", GetPath(relativePath).Native()).IsSuccess());
+        }
+
+    private:
+        AZ::Test::ScopedAutoTempDirectory m_temporaryDirectory;
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+    };
+
+    TEST_F(AmentPackageIndexTest, PackagesAreFoundInPrefixOrder)
+    {
+        const ROS2::Utils::AmentPackageIndex index(GetAmentPrefixPath());
+        EXPECT_EQ(index.GetAmentPrefixPath(), GetAmentPrefixPath());
+
+        const auto& fooShareDirectories = index.GetPackageShareDirectories("foo");
+        ASSERT_EQ(fooShareDirectories.size(), 2u);
+        EXPECT_EQ(fooShareDirectories[0], GetPath("first/share"));
+        EXPECT_EQ(fooShareDirectories[1], GetPath("second/share"));
+
+        const auto& barShareDirectories = index.GetPackageShareDirectories("bar");
+        ASSERT_EQ(barShareDirectories.size(), 1u);
+        EXPECT_EQ(barShareDirectories[0], GetPath("second/share"));
+
+        EXPECT_TRUE(index.GetPackageShareDirectories("docs").empty());
+        EXPECT_TRUE(index.GetPackageShareDirectories("baz").empty());
+        EXPECT_EQ(index.GetHitCount(), 2u);
+        EXPECT_EQ(index.GetMissCount(), 2u);
+    }
+
+    TEST_F(AmentPackageIndexTest, EmptyPrefixPathGivesEmptyIndex)
+    {
+        const ROS2::Utils::AmentPackageIndex index("");
+        EXPECT_TRUE(index.GetPackageShareDirectories("foo").empty());
+        EXPECT_EQ(index.GetMissCount(), 1u);
+    }
+
+    TEST_F(AmentPackageIndexTest, PrefixesAreScannedOnFirstLookup)
+    {
+        const ROS2::Utils::AmentPackageIndex index(GetAmentPrefixPath());
+
+        // Packages installed after the index is created, but before the first lookup, are indexed.
+        WriteTestFile("first/share/baz/package.xml");
+        ASSERT_EQ(index.GetPackageShareDirectories("baz").size(), 1u);
+        EXPECT_EQ(index.GetPackageShareDirectories("baz")[0], GetPath("first/share"));
+
+        // Prefixes are scanned only once.
+        WriteTestFile("second/share/qux/package.xml");
+        EXPECT_TRUE(index.GetPackageShareDirectories("qux").empty());
+    }
+
+    TEST_F(AmentPackageIndexTest, IndexIsEmptyWhenSettingsDoNotUseAmentPrefixPath)
+    {
+        ROS2::SdfAssetBuilderSettings settings = GetTestSettings();
+        settings.m_resolverSettings.m_useAmentPrefixPath = false;
+        const auto index = ROS2::Utils::CreateAmentPackageIndex(settings);
+        ASSERT_TRUE(index);
+        EXPECT_TRUE(index->GetAmentPrefixPath().empty());
+    }
+
+    TEST_F(AmentPackageIndexTest, ResolveAssetPathLooksUpPackagesInIndex)
+    {
+        const ROS2::Utils::AmentPackageIndex index(GetAmentPrefixPath());
+        const AZ::IO::Path urdf = GetPath("robot/robot.urdf");
+
+        // The referenced file is checked in every share directory of the package, in the prefix order.
+        const AZ::IO::Path resolvedDae = GetPath("second/share/foo/meshes/foo.dae");
+        AZStd::vector<AZ::IO::Path> checkedPaths;
+        auto mockFileSystem = [&](const AZ::IO::PathView& p) -> bool
+        {
+            checkedPaths.emplace_back(p);
+            return p == resolvedDae;
+        };
+        const auto result = ROS2::Utils::ResolveAssetPath("package://foo/meshes/foo.dae", urdf, index, GetTestSettings(), mockFileSystem);
+        EXPECT_EQ(result, resolvedDae);
+        ASSERT_EQ(checkedPaths.size(), 2u);
+        EXPECT_EQ(checkedPaths[0], GetPath("first/share/foo/meshes/foo.dae"));
+        EXPECT_EQ(checkedPaths[1], resolvedDae);
+
+        // Packages which are not indexed are not probed on disk.
+        checkedPaths.clear();
+        EXPECT_EQ(ROS2::Utils::ResolveAssetPath("model://baz/meshes/baz.dae", urdf, index, GetTestSettings(), mockFileSystem), "");
+        const AZ::IO::Path notIndexedDae = GetPath("second/share/baz/meshes/baz.dae");
+        EXPECT_EQ(AZStd::find(checkedPaths.begin(), checkedPaths.end(), notIndexedDae), checkedPaths.end());
+    }
+
+    TEST_F(AmentPackageIndexTest, ParserConfigResolvesFilesWithGivenIndex)
+    {
+        const auto index = AZStd::make_shared<const ROS2::Utils::AmentPackageIndex>(GetAmentPrefixPath());
+        const AZ::IO::Path urdf = GetPath("robot/robot.urdf");
+        const sdf::ParserConfig parserConfig = ROS2::Utils::SDFormat::CreateSdfParserConfigFromSettings(GetTestSettings(), urdf, index);
+
+        const auto findFileCallback = parserConfig.FindFileCallback();
+        ASSERT_TRUE(findFileCallback);
+        const AZ::IO::Path resolvedDae(findFileCallback("package://bar/meshes/bar.dae").c_str());
+        EXPECT_EQ(resolvedDae, GetPath("second/share/bar/meshes/bar.dae"));
+        EXPECT_EQ(index->GetHitCount(), 1u);
+
+        // Files which cannot be resolved are returned unchanged.
+        EXPECT_EQ(findFileCallback("package://baz/meshes/baz.dae"), "package://baz/meshes/baz.dae");
+        EXPECT_EQ(index->GetMissCount(), 1u);
+    }
+} // namespace UnitTest
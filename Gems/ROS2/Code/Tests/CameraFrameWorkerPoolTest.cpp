@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/conditional_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzTest/AzTest.h>
+
+#include <Camera/CameraFrameWorkerPool.h>
+
+namespace UnitTest
+{
+    //! Records frames processed by the pool, so that the test can wait for them.
+    class ProcessedFrames
+    {
+    public:
+        void Add(AZ::EntityId cameraEntityId, int frameIndex)
+        {
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                m_frames.emplace_back(cameraEntityId, frameIndex);
+            }
+            m_frameProcessed.notify_all();
+        }
+
+        //! Waits until the given count of frames was processed, and returns indices of frames of the given camera.
+        AZStd::vector<int> WaitFor(size_t frameCount, AZ::EntityId cameraEntityId)
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+            m_frameProcessed.wait(
+                lock,
+                [this, frameCount]()
+                {
+                    return m_frames.size() >= frameCount;
+                });
+
+            AZStd::vector<int> frameIndices;
+            for (const auto& [frameCameraEntityId, frameIndex] : m_frames)
+            {
+                if (frameCameraEntityId == cameraEntityId)
+                {
+                    frameIndices.push_back(frameIndex);
+                }
+            }
+            return frameIndices;
+        }
+
+    private:
+        AZStd::mutex m_mutex;
+        AZStd::condition_variable m_frameProcessed;
+        AZStd::vector<AZStd::pair<AZ::EntityId, int>> m_frames;
+    };
+
+    class CameraFrameWorkerPoolTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(CameraFrameWorkerPoolTest, FramesAreProcessedOnCallingThreadWhenInactive)
+    {
+        ROS2::CameraFrameWorkerPool pool;
+        bool isProcessed = false;
+        pool.Submit(
+            AZ::EntityId(1),
+            [&isProcessed]()
+            {
+                isProcessed = true;
+            });
+        EXPECT_TRUE(isProcessed);
+    }
+
+    TEST_F(CameraFrameWorkerPoolTest, FramesOfCameraAreProcessedInOrder)
+    {
+        constexpr int FrameCount = 200;
+        const AZ::EntityId firstCameraEntityId(1);
+        const AZ::EntityId secondCameraEntityId(2);
+        ProcessedFrames processedFrames;
+
+        ROS2::CameraFrameWorkerPool pool;
+        pool.Activate(4, FrameCount);
+        for (int frameIndex = 0; frameIndex < FrameCount; ++frameIndex)
+        {
+            for (const AZ::EntityId cameraEntityId : { firstCameraEntityId, secondCameraEntityId })
+            {
+                pool.Submit(
+                    cameraEntityId,
+                    [&processedFrames, cameraEntityId, frameIndex]()
+                    {
+                        processedFrames.Add(cameraEntityId, frameIndex);
+                    });
+            }
+        }
+
+        for (const AZ::EntityId cameraEntityId : { firstCameraEntityId, secondCameraEntityId })
+        {
+            const auto frameIndices = processedFrames.WaitFor(2 * FrameCount, cameraEntityId);
+            ASSERT_EQ(frameIndices.size(), aznumeric_cast<size_t>(FrameCount));
+            for (int frameIndex = 0; frameIndex < FrameCount; ++frameIndex)
+            {
+                EXPECT_EQ(frameIndices[frameIndex], frameIndex);
+            }
+        }
+        pool.Deactivate();
+        EXPECT_EQ(pool.GetDroppedFrameCount(), 0u);
+    }
+
+    TEST_F(CameraFrameWorkerPoolTest, OldestFramesAreDroppedOnlyFromFullCameraQueue)
+    {
+        const AZ::EntityId blockingCameraEntityId(1);
+        const AZ::EntityId busyCameraEntityId(2);
+        const AZ::EntityId idleCameraEntityId(3);
+        ProcessedFrames processedFrames;
+
+        ROS2::CameraFrameWorkerPool pool;
+        pool.Activate(1, 2);
+
+        // Keep the only worker busy, so that frames of other cameras wait in their queues.
+        AZStd::mutex blockingMutex;
+        AZStd::condition_variable blockingChanged;
+        bool isWorkerBlocked = false;
+        bool isWorkerReleased = false;
+        pool.Submit(
+            blockingCameraEntityId,
+            [&]()
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(blockingMutex);
+                isWorkerBlocked = true;
+                blockingChanged.notify_all();
+                blockingChanged.wait(
+                    lock,
+                    [&isWorkerReleased]()
+                    {
+                        return isWorkerReleased;
+                    });
+            });
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(blockingMutex);
+            blockingChanged.wait(
+                lock,
+                [&isWorkerBlocked]()
+                {
+                    return isWorkerBlocked;
+                });
+        }
+
+        pool.Submit(
+            idleCameraEntityId,
+            [&processedFrames, idleCameraEntityId]()
+            {
+                processedFrames.Add(idleCameraEntityId, 0);
+            });
+        for (int frameIndex = 0; frameIndex < 4; ++frameIndex)
+        {
+            pool.Submit(
+                busyCameraEntityId,
+                [&processedFrames, busyCameraEntityId, frameIndex]()
+                {
+                    processedFrames.Add(busyCameraEntityId, frameIndex);
+                });
+        }
+        EXPECT_EQ(pool.GetDroppedFrameCount(), 2u);
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(blockingMutex);
+            isWorkerReleased = true;
+        }
+        blockingChanged.notify_all();
+
+        EXPECT_EQ(processedFrames.WaitFor(3, idleCameraEntityId), AZStd::vector<int>({ 0 }));
+        EXPECT_EQ(processedFrames.WaitFor(3, busyCameraEntityId), AZStd::vector<int>({ 2, 3 }));
+        pool.Deactivate();
+    }
+} // namespace UnitTest
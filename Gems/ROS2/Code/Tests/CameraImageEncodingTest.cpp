@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+
+#include <Camera/CameraImageEncoding.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    namespace
+    {
+        //! Minimal QOI decoder, used to check that encoding is lossless. Returns RGBA pixels.
+        std::vector<AZ::u8> DecodeQoi(const std::vector<AZ::u8>& encoded, AZ::u32& width, AZ::u32& height)
+        {
+            auto readBigEndian = [&encoded](size_t offset)
+            {
+                return AZ::u32(encoded[offset]) << 24 | AZ::u32(encoded[offset + 1]) << 16 | AZ::u32(encoded[offset + 2]) << 8 |
+                    AZ::u32(encoded[offset + 3]);
+            };
+            width = readBigEndian(4);
+            height = readBigEndian(8);
+
+            std::vector<AZ::u8> pixels(size_t(width) * height * 4);
+            AZ::u8 index[64][4] = {};
+            AZ::u8 pixel[4] = { 0, 0, 0, 255 };
+            size_t position = 14;
+            int run = 0;
+            for (size_t offset = 0; offset < pixels.size(); offset += 4)
+            {
+                if (run > 0)
+                {
+                    --run;
+                }
+                else
+                {
+                    const AZ::u8 tag = encoded[position++];
+                    if (tag == 0xfe || tag == 0xff)
+                    {
+                        pixel[0] = encoded[position++];
+                        pixel[1] = encoded[position++];
+                        pixel[2] = encoded[position++];
+                        if (tag == 0xff)
+                        {
+                            pixel[3] = encoded[position++];
+                        }
+                    }
+                    else if ((tag & 0xc0) == 0x00)
+                    {
+                        memcpy(pixel, index[tag], 4);
+                    }
+                    else if ((tag & 0xc0) == 0x40)
+                    {
+                        pixel[0] += ((tag >> 4) & 0x03) - 2;
+                        pixel[1] += ((tag >> 2) & 0x03) - 2;
+                        pixel[2] += (tag & 0x03) - 2;
+                    }
+                    else if ((tag & 0xc0) == 0x80)
+                    {
+                        const AZ::u8 next = encoded[position++];
+                        const int dg = (tag & 0x3f) - 32;
+                        pixel[0] += dg - 8 + ((next >> 4) & 0x0f);
+                        pixel[1] += dg;
+                        pixel[2] += dg - 8 + (next & 0x0f);
+                    }
+                    else
+                    {
+                        run = tag & 0x3f;
+                    }
+                    memcpy(index[(pixel[0] * 3 + pixel[1] * 5 + pixel[2] * 7 + pixel[3] * 11) % 64], pixel, 4);
+                }
+                memcpy(pixels.data() + offset, pixel, 4);
+            }
+            return pixels;
+        }
+
+        std::vector<AZ::u8> MakeTestImage(AZ::u32 width, AZ::u32 height)
+        {
+            std::vector<AZ::u8> pixels(size_t(width) * height * 4);
+            for (AZ::u32 y = 0; y < height; ++y)
+            {
+                for (AZ::u32 x = 0; x < width; ++x)
+                {
+                    AZ::u8* pixel = pixels.data() + (size_t(y) * width + x) * 4;
+                    // Smooth gradients with flat areas and occasional sharp edges, similar to rendered images.
+                    pixel[0] = static_cast<AZ::u8>(x / 4);
+                    pixel[1] = static_cast<AZ::u8>(y / 3);
+                    pixel[2] = (x / 64 + y / 64) % 2 ? 200 : static_cast<AZ::u8>(x * y);
+                    pixel[3] = (x % 97 == 0) ? 128 : 255;
+                }
+            }
+            return pixels;
+        }
+    } // namespace
+
+    class CameraImageEncodingTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(CameraImageEncodingTest, QoiEncodingIsLossless)
+    {
+        constexpr AZ::u32 Width = 211;
+        constexpr AZ::u32 Height = 67;
+        const auto pixels = MakeTestImage(Width, Height);
+
+        std::vector<AZ::u8> encoded;
+        ROS2::CameraImageEncoding::EncodeQoi(pixels.data(), Width, Height, 4, encoded);
+        ASSERT_GT(encoded.size(), 22);
+        EXPECT_LT(encoded.size(), pixels.size());
+        EXPECT_EQ(memcmp(encoded.data(), "qoif", 4), 0);
+
+        AZ::u32 width = 0;
+        AZ::u32 height = 0;
+        const auto decoded = DecodeQoi(encoded, width, height);
+        EXPECT_EQ(width, Width);
+        EXPECT_EQ(height, Height);
+        EXPECT_EQ(decoded, pixels);
+    }
+
+    TEST_F(CameraImageEncodingTest, QoiEncodesUniformImageAsRuns)
+    {
+        const std::vector<AZ::u8> pixels(100 * 4, 255);
+        std::vector<AZ::u8> encoded;
+        ROS2::CameraImageEncoding::EncodeQoi(pixels.data(), 10, 10, 4, encoded);
+
+        // Header, diff op for the first pixel (white differs from the initial black by -1 in wrapping arithmetic),
+        // two runs (62 and 37 pixels) and the end marker.
+        EXPECT_EQ(encoded.size(), 14 + 1 + 2 + 8);
+    }
+
+    TEST_F(CameraImageEncodingTest, QuantizeDepthClampsToMillimeterRange)
+    {
+        const std::vector<float> depth = { 1.5f, 0.001f, -1.0f, 100.0f, 2.25f, 0.0f, 65.535f };
+        std::vector<AZ::u16> quantized(depth.size());
+        ROS2::CameraImageEncoding::QuantizeDepth(depth.data(), depth.size(), quantized.data());
+
+        const std::vector<AZ::u16> expected = { 1500, 1, 0, 65535, 2250, 0, 65535 };
+        EXPECT_EQ(quantized, expected);
+    }
+
+    TEST_F(CameraImageEncodingTest, DepthImageIsEncodedAsMillimeters)
+    {
+        constexpr AZ::u32 Width = 3;
+        constexpr AZ::u32 Height = 2;
+        const std::vector<float> depth = { 1.5f, 0.001f, -1.0f, 100.0f, 2.25f, 0.256f };
+
+        sensor_msgs::msg::Image image;
+        image.header.frame_id = "depth_frame";
+        image.encoding = "32FC1";
+        image.width = Width;
+        image.height = Height;
+        image.step = Width * sizeof(float);
+        image.data.resize(depth.size() * sizeof(float));
+        memcpy(image.data.data(), depth.data(), image.data.size());
+
+        sensor_msgs::msg::CompressedImage compressedImage;
+        ROS2::CameraImageEncoding::DepthEncodingBuffers depthBuffers;
+        ASSERT_TRUE(ROS2::CameraImageEncoding::EncodeImage(image, compressedImage, depthBuffers));
+        EXPECT_EQ(compressedImage.format, ROS2::CameraImageEncoding::DepthFormat);
+        EXPECT_EQ(compressedImage.header.frame_id, image.header.frame_id);
+
+        AZ::u32 width = 0;
+        AZ::u32 height = 0;
+        const auto decoded = DecodeQoi(compressedImage.data, width, height);
+        ASSERT_EQ(width, Width);
+        ASSERT_EQ(height, Height);
+
+        // High byte of the depth in millimeters is in the red channel, and the low byte in the green channel.
+        const std::vector<AZ::u16> expected = { 1500, 1, 0, 65535, 2250, 256 };
+        std::vector<AZ::u16> millimeters(expected.size());
+        for (size_t i = 0; i < millimeters.size(); ++i)
+        {
+            millimeters[i] = static_cast<AZ::u16>(decoded[i * 4] << 8 | decoded[i * 4 + 1]);
+        }
+        EXPECT_EQ(millimeters, expected);
+    }
+
+    TEST_F(CameraImageEncodingTest, UnsupportedEncodingIsNotEncoded)
+    {
+        sensor_msgs::msg::Image image;
+        image.encoding = "mono16";
+        image.width = 2;
+        image.height = 2;
+        image.data.resize(8);
+
+        sensor_msgs::msg::CompressedImage compressedImage;
+        ROS2::CameraImageEncoding::DepthEncodingBuffers depthBuffers;
+        EXPECT_FALSE(ROS2::CameraImageEncoding::EncodeImage(image, compressedImage, depthBuffers));
+    }
+
+#if defined(HAVE_BENCHMARK)
+    class CameraImageEncodingBenchmarkFixture : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            m_pixels = MakeTestImage(Width, Height);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            m_pixels = {};
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        static constexpr AZ::u32 Width = 1920;
+        static constexpr AZ::u32 Height = 1080;
+        std::vector<AZ::u8> m_pixels;
+    };
+
+    //! Encode throughput of a single core, reported as raw image bytes per second.
+    BENCHMARK_F(CameraImageEncodingBenchmarkFixture, BM_EncodeQoi)(benchmark::State& state)
+    {
+        std::vector<AZ::u8> encoded;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ROS2::CameraImageEncoding::EncodeQoi(m_pixels.data(), Width, Height, 4, encoded);
+            benchmark::DoNotOptimize(encoded.data());
+        }
+        state.SetBytesProcessed(state.iterations() * m_pixels.size());
+        state.counters["CompressionRatio"] = static_cast<double>(m_pixels.size()) / encoded.size();
+    }
+#endif
+} // namespace UnitTest
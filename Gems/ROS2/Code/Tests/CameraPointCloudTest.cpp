@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/array.h>
+#include <AzTest/AzTest.h>
+
+#include <Camera/CameraPointCloud.h>
+
+#include <cmath>
+
+namespace UnitTest
+{
+    class CameraPointCloudTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(CameraPointCloudTest, PixelRaysFollowOpticalFrame)
+    {
+        // With a 90 degree vertical field of view, the image edges are at 45 degrees from the optical axis.
+        const auto rays = ROS2::CameraPointCloud::ComputePixelRays(4, 4, 90.0f);
+        ASSERT_EQ(rays.m_x.size(), 16);
+
+        // Principal point is in the center of the image, on pixel (2, 2).
+        EXPECT_NEAR(rays.m_x[2 * 4 + 2], 0.0f, 1e-6f);
+        EXPECT_NEAR(rays.m_y[2 * 4 + 2], 0.0f, 1e-6f);
+        // Optical frame: x to the right, y down.
+        EXPECT_NEAR(rays.m_x[2 * 4 + 0], -1.0f, 1e-5f);
+        EXPECT_NEAR(rays.m_y[0 * 4 + 2], -1.0f, 1e-5f);
+        EXPECT_NEAR(rays.m_x[2 * 4 + 3], 0.5f, 1e-5f);
+    }
+
+    TEST_F(CameraPointCloudTest, PixelRaysAreSharedBetweenCameras)
+    {
+        ROS2::CameraPointCloud::PixelRaysCache cache;
+        auto rays = ROS2::CameraPointCloud::GetCachedPixelRays(cache, 64, 48, 60.0f);
+        EXPECT_EQ(rays, ROS2::CameraPointCloud::GetCachedPixelRays(cache, 64, 48, 60.0f));
+        EXPECT_NE(rays, ROS2::CameraPointCloud::GetCachedPixelRays(cache, 64, 48, 70.0f));
+        EXPECT_NE(rays, ROS2::CameraPointCloud::GetCachedPixelRays(cache, 64, 32, 60.0f));
+
+        // Rays released by all cameras are pruned on the next lookup.
+        rays.reset();
+        const auto otherRays = ROS2::CameraPointCloud::GetCachedPixelRays(cache, 32, 24, 60.0f);
+        EXPECT_EQ(cache.GetEntryCount(), 1u);
+
+        cache.Clear();
+        EXPECT_EQ(cache.GetEntryCount(), 0u);
+        EXPECT_NE(otherRays, ROS2::CameraPointCloud::GetCachedPixelRays(cache, 32, 24, 60.0f));
+    }
+
+    TEST_F(CameraPointCloudTest, FillPointCloudBackProjectsDepth)
+    {
+        constexpr int Width = 5;
+        constexpr int Height = 3;
+        const auto rays = ROS2::CameraPointCloud::ComputePixelRays(Width, Height, 90.0f);
+        std::vector<float> depth(Width * Height, 2.0f);
+        depth[3] = 0.0f; // No depth.
+        depth[7] = 100.0f; // At the far clip distance.
+        std::vector<AZ::u8> colors(Width * Height * 4, 0);
+        colors[13 * 4] = 0x12;
+        colors[13 * 4 + 1] = 0x34;
+        colors[13 * 4 + 2] = 0x56;
+
+        std_msgs::msg::Header header;
+        header.frame_id = "camera";
+        sensor_msgs::msg::PointCloud2 message;
+        ROS2::CameraPointCloud::FillPointCloud(rays, depth.data(), colors.data(), 100.0f, header, message);
+
+        ASSERT_EQ(message.width, Width);
+        ASSERT_EQ(message.height, Height);
+        ASSERT_EQ(message.fields.size(), 4);
+        ASSERT_EQ(message.point_step, 16);
+        ASSERT_EQ(message.data.size(), Width * Height * 16);
+        EXPECT_EQ(message.header.frame_id, "camera");
+
+        auto point = [&message](size_t index)
+        {
+            float values[4];
+            memcpy(values, message.data.data() + index * message.point_step, sizeof(values));
+            return AZStd::array<float, 4>{ values[0], values[1], values[2], values[3] };
+        };
+
+        for (size_t i = 0; i < depth.size(); ++i)
+        {
+            const auto p = point(i);
+            if (i == 3 || i == 7)
+            {
+                EXPECT_TRUE(std::isnan(p[0]) && std::isnan(p[1]) && std::isnan(p[2]));
+                continue;
+            }
+            EXPECT_NEAR(p[0], rays.m_x[i] * 2.0f, 1e-5f);
+            EXPECT_NEAR(p[1], rays.m_y[i] * 2.0f, 1e-5f);
+            EXPECT_EQ(p[2], 2.0f);
+        }
+
+        AZ::u32 rgb = 0;
+        memcpy(&rgb, message.data.data() + 13 * message.point_step + 12, sizeof(rgb));
+        EXPECT_EQ(rgb, 0x123456u);
+    }
+} // namespace UnitTest
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzTest/AzTest.h>
+#include <ROS2/Utilities/ConcurrencyUtilities.h>
+
+namespace UnitTest
+{
+    class ConcurrencyUtilitiesTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            AZ::JobManagerDesc jobManagerDesc;
+            for (int i = 0; i < 2; ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        void TearDown() override
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+    private:
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+    };
+
+    TEST_F(ConcurrencyUtilitiesTest, TaskIsCalledOnceForEveryIndex)
+    {
+        constexpr size_t Count = 1000;
+        for (const AZ::u64 maxConcurrency : { 1u, 3u, 5000u })
+        {
+            AZStd::array<AZStd::atomic<int>, Count> callCounts{};
+            ROS2::ConcurrencyUtilities::ForEachConcurrently(
+                Count,
+                maxConcurrency,
+                [&callCounts](size_t index)
+                {
+                    ++callCounts[index];
+                });
+            for (size_t index = 0; index < Count; ++index)
+            {
+                EXPECT_EQ(callCounts[index], 1) << "index " << index << ", max concurrency " << maxConcurrency;
+            }
+        }
+    }
+
+    TEST_F(ConcurrencyUtilitiesTest, SingleJobRunsOnCallingThread)
+    {
+        const AZStd::thread_id callingThreadId = AZStd::this_thread::get_id();
+        size_t callCount = 0;
+        ROS2::ConcurrencyUtilities::ForEachConcurrently(
+            10,
+            1,
+            [&callCount, callingThreadId](size_t index)
+            {
+                EXPECT_EQ(index, callCount);
+                EXPECT_EQ(AZStd::this_thread::get_id(), callingThreadId);
+                ++callCount;
+            });
+        EXPECT_EQ(callCount, 10u);
+    }
+} // namespace UnitTest
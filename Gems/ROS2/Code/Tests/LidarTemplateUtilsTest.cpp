@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+
+#include <Lidar/LidarTemplateUtils.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    class LidarTemplateUtilsTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(LidarTemplateUtilsTest, RotateDirectionsMatchesPerRayPath)
+    {
+        using namespace ROS2;
+        const auto lidarTemplate = LidarTemplateUtils::GetTemplate(LidarTemplate::LidarModel::Ouster_OS0_64);
+        const auto rotations = LidarTemplateUtils::PopulateRayRotations(lidarTemplate);
+        const AZ::Transform lidarTransform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateFromEulerRadiansZYX(AZ::Vector3(0.3f, -1.1f, 2.4f)), AZ::Vector3(1.0f, 2.0f, 3.0f));
+
+        const auto expected = LidarTemplateUtils::RotationsToDirections(rotations, lidarTransform);
+        const auto localDirections = LidarTemplateUtils::RotationsToLocalDirections(rotations);
+        LidarTemplateUtils::RayDirections directions;
+        LidarTemplateUtils::RotateDirections(
+            localDirections, AZ::Matrix3x3::CreateFromQuaternion(lidarTransform.GetRotation()), directions);
+
+        ASSERT_EQ(directions.Size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_NEAR(directions.m_x[i], expected[i].GetX(), 1e-5f);
+            EXPECT_NEAR(directions.m_y[i], expected[i].GetY(), 1e-5f);
+            EXPECT_NEAR(directions.m_z[i], expected[i].GetZ(), 1e-5f);
+        }
+    }
+
+    TEST_F(LidarTemplateUtilsTest, CachedLocalDirectionsAreShared)
+    {
+        using namespace ROS2;
+        const auto lidarTemplate = LidarTemplateUtils::GetTemplate(LidarTemplate::LidarModel::Velodyne_Puck);
+        const auto rotations = LidarTemplateUtils::PopulateRayRotations(lidarTemplate);
+
+        LidarTemplateUtils::RayDirectionsCache cache;
+        auto first = LidarTemplateUtils::GetCachedLocalDirections(cache, rotations);
+        auto second = LidarTemplateUtils::GetCachedLocalDirections(cache, rotations);
+        EXPECT_EQ(first.get(), second.get());
+        EXPECT_EQ(first->Size(), rotations.size());
+        EXPECT_EQ(cache.GetEntryCount(), 1);
+
+        // Directions are released with their last user and the expired entry is pruned on the next lookup.
+        first.reset();
+        second.reset();
+        const auto other = LidarTemplateUtils::GetCachedLocalDirections(cache, { AZ::Vector3::CreateZero() });
+        EXPECT_EQ(cache.GetEntryCount(), 1);
+        EXPECT_EQ(other->Size(), 1);
+
+        cache.Clear();
+        EXPECT_EQ(cache.GetEntryCount(), 0);
+    }
+
+#if defined(HAVE_BENCHMARK)
+    class LidarDirectionsBenchmarkFixture : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            // Ouster OS0-64 has 64 layers and 2048 increments.
+            const auto lidarTemplate = ROS2::LidarTemplateUtils::GetTemplate(ROS2::LidarTemplate::LidarModel::Ouster_OS0_64);
+            m_rotations = ROS2::LidarTemplateUtils::PopulateRayRotations(lidarTemplate);
+            m_localDirections = ROS2::LidarTemplateUtils::RotationsToLocalDirections(m_rotations);
+            m_lidarTransform = AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateFromEulerRadiansZYX(AZ::Vector3(0.3f, -1.1f, 2.4f)), AZ::Vector3(1.0f, 2.0f, 3.0f));
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            m_localDirections = {};
+            m_rotations = {};
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZStd::vector<AZ::Vector3> m_rotations;
+        ROS2::LidarTemplateUtils::RayDirections m_localDirections;
+        AZ::Transform m_lidarTransform;
+    };
+
+    BENCHMARK_F(LidarDirectionsBenchmarkFixture, BM_RotationsToDirections)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto directions = ROS2::LidarTemplateUtils::RotationsToDirections(m_rotations, m_lidarTransform);
+            benchmark::DoNotOptimize(directions.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_rotations.size());
+    }
+
+    BENCHMARK_F(LidarDirectionsBenchmarkFixture, BM_RotateDirections)(benchmark::State& state)
+    {
+        ROS2::LidarTemplateUtils::RayDirections directions;
+        const AZ::Matrix3x3 rotation = AZ::Matrix3x3::CreateFromQuaternion(m_lidarTransform.GetRotation());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ROS2::LidarTemplateUtils::RotateDirections(m_localDirections, rotation, directions);
+            benchmark::DoNotOptimize(directions.m_x.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_rotations.size());
+    }
+#endif
+} // namespace UnitTest
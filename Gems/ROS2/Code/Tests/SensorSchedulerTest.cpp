@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzTest/AzTest.h>
+
+#include <Sensor/SensorScheduler.h>
+
+namespace UnitTest
+{
+    //! Scheduler stepped by tests instead of the default physics scene.
+    class TestSensorScheduler : public ROS2::SensorScheduler
+    {
+    public:
+        using SensorScheduler::OnSceneSimulationStart;
+
+    protected:
+        bool ConnectToPhysicsScene() override
+        {
+            return true;
+        }
+    };
+
+    class SensorSchedulerTest : public LeakDetectionFixture
+    {
+    public:
+        using SchedulePhase = ROS2::SensorScheduler::SchedulePhase;
+
+        static constexpr float StepDuration = 1.0f / 60.0f;
+
+        //! Runs physics steps, checking the sensor for a publication deadline on each step.
+        //! @return Numbers of steps on which the sensor published, counted from firstStep.
+        static AZStd::vector<AZ::u64> GetPublicationSteps(
+            TestSensorScheduler& scheduler, ROS2::SensorScheduleId sensorId, AZ::u64 firstStep, AZ::u64 lastStep)
+        {
+            AZStd::vector<AZ::u64> publicationSteps;
+            for (AZ::u64 step = firstStep; step <= lastStep; ++step)
+            {
+                scheduler.OnSceneSimulationStart(StepDuration);
+                if (scheduler.IsPublicationDeadline(sensorId))
+                {
+                    publicationSteps.push_back(step);
+                    // The deadline is reported once per scheduled step.
+                    EXPECT_FALSE(scheduler.IsPublicationDeadline(sensorId));
+                }
+            }
+            return publicationSteps;
+        }
+
+        //! Schedules sensors one by one, the same way the scheduler does on registration.
+        static AZStd::vector<SchedulePhase> Schedule(const AZStd::vector<AZ::u32>& periods)
+        {
+            AZStd::vector<SchedulePhase> scheduled;
+            for (const AZ::u32 period : periods)
+            {
+                const AZ::u32 offset = ROS2::SensorScheduler::SelectPhaseOffset(period, scheduled);
+                EXPECT_LT(offset, period);
+                scheduled.push_back({ period, offset });
+            }
+            return scheduled;
+        }
+
+        //! Returns the highest number of sensors publishing on the same step.
+        static AZ::u32 GetMaxLoad(const AZStd::vector<SchedulePhase>& scheduled, AZ::u32 hyperPeriod)
+        {
+            AZ::u32 maxLoad = 0;
+            for (AZ::u32 step = 0; step < hyperPeriod; ++step)
+            {
+                const auto load = AZStd::count_if(
+                    scheduled.begin(),
+                    scheduled.end(),
+                    [step](const SchedulePhase& phase)
+                    {
+                        return step % phase.m_period == phase.m_offset;
+                    });
+                maxLoad = AZStd::max(maxLoad, aznumeric_cast<AZ::u32>(load));
+            }
+            return maxLoad;
+        }
+    };
+
+    TEST_F(SensorSchedulerTest, FirstSensorStartsWithoutOffset)
+    {
+        EXPECT_EQ(ROS2::SensorScheduler::SelectPhaseOffset(6, {}), 0u);
+        EXPECT_EQ(ROS2::SensorScheduler::SelectPhaseOffset(1, { { 1, 0 } }), 0u);
+    }
+
+    TEST_F(SensorSchedulerTest, SensorsWithEqualPeriodsPublishOnDifferentSteps)
+    {
+        // Six 10Hz sensors in a 60Hz simulation.
+        const auto scheduled = Schedule({ 6, 6, 6, 6, 6, 6 });
+        EXPECT_EQ(GetMaxLoad(scheduled, 6), 1u);
+
+        // The seventh sensor has to share a step with one of them.
+        const auto crowded = Schedule({ 6, 6, 6, 6, 6, 6, 6 });
+        EXPECT_EQ(GetMaxLoad(crowded, 6), 2u);
+    }
+
+    TEST_F(SensorSchedulerTest, SensorsWithRelatedPeriodsAreStaggered)
+    {
+        // 10Hz, 20Hz and 30Hz sensors in a 60Hz simulation, 10 publications per 6 steps.
+        const AZStd::vector<AZ::u32> periods{ 6, 6, 6, 3, 3, 2 };
+        const auto scheduled = Schedule(periods);
+        EXPECT_LE(GetMaxLoad(scheduled, 6), 3u);
+
+        AZStd::vector<SchedulePhase> unstaggered;
+        for (const AZ::u32 period : periods)
+        {
+            unstaggered.push_back({ period, 0 });
+        }
+        EXPECT_EQ(GetMaxLoad(unstaggered, 6), periods.size());
+    }
+
+    TEST_F(SensorSchedulerTest, OffsetsAvoidCollisionsWherePeriodsAllow)
+    {
+        // A 2-step sensor at offset 0 collides with a 4-step sensor only on even offsets.
+        EXPECT_EQ(ROS2::SensorScheduler::SelectPhaseOffset(4, { { 2, 0 } }) % 2, 1u);
+        // Sensors with coprime periods meet every lcm steps regardless of offsets, so the first offset is kept.
+        EXPECT_EQ(ROS2::SensorScheduler::SelectPhaseOffset(3, { { 2, 0 } }), 0u);
+    }
+
+    TEST_F(SensorSchedulerTest, SensorsAreRegisteredOnlyWhenActive)
+    {
+        TestSensorScheduler scheduler;
+        EXPECT_EQ(scheduler.RegisterSensor(10.0f), ROS2::InvalidSensorScheduleId);
+
+        scheduler.Activate();
+        const ROS2::SensorScheduleId sensorId = scheduler.RegisterSensor(10.0f);
+        EXPECT_NE(sensorId, ROS2::InvalidSensorScheduleId);
+        EXPECT_TRUE(scheduler.IsSensorRegistered(sensorId));
+        EXPECT_NE(scheduler.RegisterSensor(10.0f), sensorId);
+
+        // Deactivation forgets registered sensors, so that they can fall back to timing publications by themselves.
+        scheduler.Deactivate();
+        EXPECT_EQ(scheduler.RegisterSensor(10.0f), ROS2::InvalidSensorScheduleId);
+        EXPECT_FALSE(scheduler.IsSensorRegistered(sensorId));
+        EXPECT_FALSE(scheduler.IsPublicationDeadline(sensorId));
+    }
+
+    TEST_F(SensorSchedulerTest, PublicationsFollowAssignedPhases)
+    {
+        TestSensorScheduler scheduler;
+        scheduler.Activate();
+
+        // 10Hz sensors in a 60Hz simulation, the second one is shifted by a step.
+        const ROS2::SensorScheduleId firstSensorId = scheduler.RegisterSensor(10.0f);
+        const ROS2::SensorScheduleId secondSensorId = scheduler.RegisterSensor(10.0f);
+        AZStd::vector<AZ::u64> firstSensorSteps;
+        AZStd::vector<AZ::u64> secondSensorSteps;
+        for (AZ::u64 step = 1; step <= 18; ++step)
+        {
+            scheduler.OnSceneSimulationStart(StepDuration);
+            if (scheduler.IsPublicationDeadline(firstSensorId))
+            {
+                firstSensorSteps.push_back(step);
+            }
+            if (scheduler.IsPublicationDeadline(secondSensorId))
+            {
+                secondSensorSteps.push_back(step);
+            }
+        }
+        EXPECT_EQ(firstSensorSteps, AZStd::vector<AZ::u64>({ 6, 12, 18 }));
+        EXPECT_EQ(secondSensorSteps, AZStd::vector<AZ::u64>({ 1, 7, 13 }));
+
+        scheduler.UnregisterSensor(secondSensorId);
+        EXPECT_TRUE(scheduler.IsSensorRegistered(firstSensorId));
+        EXPECT_FALSE(scheduler.IsSensorRegistered(secondSensorId));
+        EXPECT_FALSE(scheduler.IsSensorRegistered(ROS2::InvalidSensorScheduleId));
+        EXPECT_TRUE(GetPublicationSteps(scheduler, secondSensorId, 19, 30).empty());
+        EXPECT_FALSE(scheduler.IsPublicationDeadline(ROS2::InvalidSensorScheduleId));
+    }
+
+    TEST_F(SensorSchedulerTest, PeriodFollowsPhysicsStepDuration)
+    {
+        TestSensorScheduler scheduler;
+        scheduler.Activate();
+
+        // A 10Hz sensor in a 100Hz simulation publishes every 10 steps.
+        scheduler.OnSceneSimulationStart(0.01f);
+        const ROS2::SensorScheduleId sensorId = scheduler.RegisterSensor(10.0f);
+        AZStd::vector<AZ::u64> publicationSteps;
+        for (AZ::u64 step = 2; step <= 20; ++step)
+        {
+            scheduler.OnSceneSimulationStart(0.01f);
+            if (scheduler.IsPublicationDeadline(sensorId))
+            {
+                publicationSteps.push_back(step);
+            }
+        }
+        EXPECT_EQ(publicationSteps, AZStd::vector<AZ::u64>({ 10, 20 }));
+    }
+
+    TEST_F(SensorSchedulerTest, MissedPublicationsAreRealignedToPhase)
+    {
+        TestSensorScheduler scheduler;
+        scheduler.Activate();
+        const ROS2::SensorScheduleId sensorId = scheduler.RegisterSensor(10.0f);
+
+        // The sensor is not asked on steps 6, 12 and 18, e.g. because a frame took several physics steps.
+        for (AZ::u64 step = 1; step < 20; ++step)
+        {
+            scheduler.OnSceneSimulationStart(StepDuration);
+        }
+
+        // The late publication is not followed by the missed ones, the next one is back on the phase of the sensor.
+        EXPECT_EQ(GetPublicationSteps(scheduler, sensorId, 20, 36), AZStd::vector<AZ::u64>({ 20, 24, 30, 36 }));
+    }
+
+    TEST_F(SensorSchedulerTest, FrequencyChangeReschedulesSensor)
+    {
+        TestSensorScheduler scheduler;
+        scheduler.Activate();
+        const ROS2::SensorScheduleId sensorId = scheduler.RegisterSensor(10.0f);
+
+        scheduler.SetSensorFrequency(sensorId, 30.0f);
+        EXPECT_EQ(GetPublicationSteps(scheduler, sensorId, 1, 6), AZStd::vector<AZ::u64>({ 2, 4, 6 }));
+
+        // Non-positive frequency is assumed to be 1Hz.
+        scheduler.SetSensorFrequency(sensorId, 0.0f);
+        EXPECT_EQ(GetPublicationSteps(scheduler, sensorId, 7, 120), AZStd::vector<AZ::u64>({ 60, 120 }));
+
+        // Frequency of sensors which are not registered is not changed.
+        scheduler.UnregisterSensor(sensorId);
+        scheduler.SetSensorFrequency(sensorId, 60.0f);
+        EXPECT_TRUE(GetPublicationSteps(scheduler, sensorId, 121, 130).empty());
+    }
+
+    TEST_F(SensorSchedulerTest, LoadIsMeasuredOverWindow)
+    {
+        TestSensorScheduler scheduler;
+        scheduler.Activate(4);
+
+        // 30Hz sensors in a 60Hz simulation publish on alternate steps.
+        AZStd::vector<ROS2::SensorScheduleId> sensorIds{ scheduler.RegisterSensor(30.0f), scheduler.RegisterSensor(30.0f) };
+        auto publishDueSensors = [&scheduler, &sensorIds]()
+        {
+            for (const ROS2::SensorScheduleId sensorId : sensorIds)
+            {
+                scheduler.IsPublicationDeadline(sensorId);
+            }
+        };
+        for (AZ::u64 step = 1; step <= 4; ++step)
+        {
+            scheduler.OnSceneSimulationStart(StepDuration);
+            publishDueSensors();
+        }
+        // The load of a step is committed when the next step starts.
+        EXPECT_EQ(scheduler.GetLoadStatistics().m_stepCount, 0u);
+
+        scheduler.OnSceneSimulationStart(StepDuration);
+        ROS2::SensorLoadStatistics statistics = scheduler.GetLoadStatistics();
+        EXPECT_EQ(statistics.m_stepCount, 4u);
+        EXPECT_EQ(statistics.m_publicationCount, 4u);
+        EXPECT_EQ(statistics.m_maxPublicationsPerStep, 1u);
+        EXPECT_FLOAT_EQ(statistics.m_meanPublicationsPerStep, 1.0f);
+        EXPECT_EQ(statistics.m_scheduledSensorCount, 2u);
+
+        // The third sensor has to share steps with one of the others.
+        sensorIds.push_back(scheduler.RegisterSensor(30.0f));
+        publishDueSensors();
+        for (AZ::u64 step = 6; step <= 8; ++step)
+        {
+            scheduler.OnSceneSimulationStart(StepDuration);
+            publishDueSensors();
+        }
+        scheduler.OnSceneSimulationStart(StepDuration);
+        statistics = scheduler.GetLoadStatistics();
+        EXPECT_EQ(statistics.m_stepCount, 4u);
+        EXPECT_EQ(statistics.m_publicationCount, 6u);
+        EXPECT_EQ(statistics.m_maxPublicationsPerStep, 2u);
+        EXPECT_FLOAT_EQ(statistics.m_meanPublicationsPerStep, 1.5f);
+        EXPECT_EQ(statistics.m_scheduledSensorCount, 3u);
+
+        scheduler.Deactivate();
+        EXPECT_EQ(scheduler.GetLoadStatistics().m_stepCount, 0u);
+    }
+} // namespace UnitTest
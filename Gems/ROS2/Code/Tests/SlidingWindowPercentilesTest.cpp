@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
+#include <AzTest/AzTest.h>
+
+#include <ROS2/Clock/SlidingWindowPercentiles.h>
+
+namespace UnitTest
+{
+    class SlidingWindowPercentilesTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(SlidingWindowPercentilesTest, EmptyWindowReturnsZero)
+    {
+        ROS2::SlidingWindowPercentiles<8> percentiles;
+        EXPECT_EQ(percentiles.GetSampleCount(), 0);
+        EXPECT_EQ(percentiles.GetPercentile(0.5f), 0);
+    }
+
+    TEST_F(SlidingWindowPercentilesTest, MatchesSortedWindow)
+    {
+        constexpr size_t WindowSize = 60;
+        ROS2::SlidingWindowPercentiles<WindowSize> percentiles;
+        AZStd::deque<AZ::s64> window;
+
+        // Deterministic pseudo-random sequence with repeated values and occasional spikes.
+        AZ::u32 state = 12345;
+        for (size_t i = 0; i < 500; ++i)
+        {
+            state = state * 1664525u + 1013904223u;
+            const AZ::s64 sample = (state >> 16) % 100 + ((state & 0xff) == 0 ? 10000 : 0);
+            percentiles.AddSample(sample);
+            window.push_back(sample);
+            if (window.size() > WindowSize)
+            {
+                window.pop_front();
+            }
+
+            AZStd::vector<AZ::s64> sorted(window.begin(), window.end());
+            AZStd::sort(sorted.begin(), sorted.end());
+            ASSERT_EQ(percentiles.GetSampleCount(), sorted.size());
+            EXPECT_EQ(percentiles.GetPercentile(0.0f), sorted.front());
+            EXPECT_EQ(percentiles.GetPercentile(0.5f), sorted[sorted.size() / 2]);
+            EXPECT_EQ(percentiles.GetPercentile(1.0f), sorted.back());
+        }
+    }
+} // namespace UnitTest
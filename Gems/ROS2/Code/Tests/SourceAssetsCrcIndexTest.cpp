@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UnitTest/Utils.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzTest/AzTest.h>
+#include <RobotImporter/Utils/SourceAssetsCrcIndex.h>
+#include <RobotImporter/Utils/SourceAssetsStorage.h>
+
+namespace UnitTest
+{
+    class SourceAssetsCrcIndexTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            // Checksums of files missing in the index are computed in jobs.
+            AZ::JobManagerDesc jobManagerDesc;
+            jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        void TearDown() override
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZ::IO::Path GetFilePath(const char* fileName) const
+        {
+            return AZ::IO::Path(m_temporaryDirectory.GetDirectory()) / fileName;
+        }
+
+        AZ::IO::Path GetIndexFilePath() const
+        {
+            return GetFilePath("SourceAssetsCrcIndex.txt");
+        }
+
+        AZ::IO::Path WriteTestFile(const char* fileName, AZStd::string_view content) const
+        {
+            const AZ::IO::Path filePath = GetFilePath(fileName);
+            EXPECT_TRUE(AZ::Utils::WriteFile(content, filePath.Native()).IsSuccess());
+            return filePath;
+        }
+
+        //! Writes an index file with a single entry for the given file.
+        void WriteIndexEntry(const AZ::IO::Path& filePath, AZ::u32 crc, AZ::u64 size, AZ::u64 modificationTime) const
+        {
+            const AZStd::string content = AZStd::string::format(
+                "# ROS2 source assets CRC index v1: crc size modification_time path\n%u %llu %llu %s\n",
+                crc,
+                static_cast<unsigned long long>(size),
+                static_cast<unsigned long long>(modificationTime),
+                filePath.c_str());
+            EXPECT_TRUE(AZ::Utils::WriteFile(content, GetIndexFilePath().Native()).IsSuccess());
+        }
+
+    private:
+        AZ::Test::ScopedAutoTempDirectory m_temporaryDirectory;
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+    };
+
+    TEST_F(SourceAssetsCrcIndexTest, SavedIndexIsLoaded)
+    {
+        const AZStd::vector<AZ::IO::Path> files{ WriteTestFile("mesh.dae", "mesh"), WriteTestFile("texture with spaces.png", "texture") };
+
+        ROS2::Utils::SourceAssetsCrcIndex index(GetIndexFilePath());
+        EXPECT_FALSE(index.Load());
+        const auto crcs = index.GetFileCRCs(files);
+        ASSERT_EQ(crcs.size(), 2u);
+        EXPECT_EQ(crcs[0], ROS2::Utils::GetFileCRC(files[0]));
+        EXPECT_EQ(crcs[1], ROS2::Utils::GetFileCRC(files[1]));
+        EXPECT_EQ(index.GetMissCount(), 2u);
+        EXPECT_TRUE(index.Save());
+
+        ROS2::Utils::SourceAssetsCrcIndex loadedIndex(GetIndexFilePath());
+        EXPECT_TRUE(loadedIndex.Load());
+        EXPECT_EQ(loadedIndex.GetFileCRCs(files), crcs);
+        EXPECT_EQ(loadedIndex.GetHitCount(), 2u);
+        EXPECT_EQ(loadedIndex.GetMissCount(), 0u);
+    }
+
+    TEST_F(SourceAssetsCrcIndexTest, EntriesOfChangedFilesAreInvalidated)
+    {
+        const AZ::IO::Path filePath = WriteTestFile("mesh.dae", "mesh");
+        const AZ::u64 size = AZ::IO::SystemFile::Length(filePath.c_str());
+        const AZ::u64 modificationTime = AZ::IO::SystemFile::ModificationTime(filePath.c_str());
+        const AZ::u32 indexedCrc = static_cast<AZ::u32>(ROS2::Utils::GetFileCRC(filePath)) + 1;
+
+        // The index is trusted as long as the size and modification time match, even if the file content changed since.
+        WriteIndexEntry(filePath, indexedCrc, size, modificationTime);
+        ROS2::Utils::SourceAssetsCrcIndex unchangedIndex(GetIndexFilePath());
+        EXPECT_TRUE(unchangedIndex.Load());
+        EXPECT_EQ(unchangedIndex.GetFileCRCs({ filePath }).front(), AZ::Crc32(indexedCrc));
+        EXPECT_EQ(unchangedIndex.GetHitCount(), 1u);
+
+        WriteIndexEntry(filePath, indexedCrc, size, modificationTime + 1);
+        ROS2::Utils::SourceAssetsCrcIndex modifiedIndex(GetIndexFilePath());
+        EXPECT_TRUE(modifiedIndex.Load());
+        EXPECT_EQ(modifiedIndex.GetFileCRCs({ filePath }).front(), ROS2::Utils::GetFileCRC(filePath));
+        EXPECT_EQ(modifiedIndex.GetMissCount(), 1u);
+
+        WriteIndexEntry(filePath, indexedCrc, size + 1, modificationTime);
+        ROS2::Utils::SourceAssetsCrcIndex resizedIndex(GetIndexFilePath());
+        EXPECT_TRUE(resizedIndex.Load());
+        EXPECT_EQ(resizedIndex.GetFileCRCs({ filePath }).front(), ROS2::Utils::GetFileCRC(filePath));
+        EXPECT_EQ(resizedIndex.GetMissCount(), 1u);
+
+        // The recomputed checksum replaces the stale one.
+        EXPECT_TRUE(resizedIndex.Save());
+        ROS2::Utils::SourceAssetsCrcIndex updatedIndex(GetIndexFilePath());
+        EXPECT_TRUE(updatedIndex.Load());
+        EXPECT_EQ(updatedIndex.GetFileCRCs({ filePath }).front(), ROS2::Utils::GetFileCRC(filePath));
+        EXPECT_EQ(updatedIndex.GetHitCount(), 1u);
+    }
+
+    TEST_F(SourceAssetsCrcIndexTest, EntriesNotLookedUpArePrunedOnSave)
+    {
+        const AZ::IO::Path keptFile = WriteTestFile("kept.dae", "kept");
+        const AZ::IO::Path removedFile = WriteTestFile("removed.dae", "removed");
+
+        ROS2::Utils::SourceAssetsCrcIndex index(GetIndexFilePath());
+        index.GetFileCRCs({ keptFile, removedFile });
+        EXPECT_TRUE(index.Save());
+
+        ROS2::Utils::SourceAssetsCrcIndex prunedIndex(GetIndexFilePath());
+        EXPECT_TRUE(prunedIndex.Load());
+        prunedIndex.GetFileCRCs({ keptFile });
+        EXPECT_TRUE(prunedIndex.Save());
+
+        ROS2::Utils::SourceAssetsCrcIndex loadedIndex(GetIndexFilePath());
+        EXPECT_TRUE(loadedIndex.Load());
+        loadedIndex.GetFileCRCs({ keptFile, removedFile });
+        EXPECT_EQ(loadedIndex.GetHitCount(), 1u);
+        EXPECT_EQ(loadedIndex.GetMissCount(), 1u);
+    }
+
+    TEST_F(SourceAssetsCrcIndexTest, UnreadableFilesAreNotIndexed)
+    {
+        const AZ::IO::Path missingFile = GetFilePath("missing.dae");
+
+        ROS2::Utils::SourceAssetsCrcIndex index(GetIndexFilePath());
+        EXPECT_EQ(index.GetFileCRCs({ missingFile }).front(), AZ::Crc32(0));
+        EXPECT_EQ(index.GetFileCRCs({ missingFile }).front(), AZ::Crc32(0));
+        EXPECT_EQ(index.GetHitCount(), 0u);
+        EXPECT_EQ(index.GetMissCount(), 2u);
+    }
+
+    TEST_F(SourceAssetsCrcIndexTest, MissingOrCorruptIndexIsIgnored)
+    {
+        const AZ::IO::Path filePath = WriteTestFile("mesh.dae", "mesh");
+
+        ROS2::Utils::SourceAssetsCrcIndex missingIndex(GetIndexFilePath());
+        EXPECT_FALSE(missingIndex.Load());
+
+        WriteTestFile("SourceAssetsCrcIndex.txt", "not an index\n");
+        ROS2::Utils::SourceAssetsCrcIndex unknownFormatIndex(GetIndexFilePath());
+        EXPECT_FALSE(unknownFormatIndex.Load());
+        EXPECT_EQ(unknownFormatIndex.GetFileCRCs({ filePath }).front(), ROS2::Utils::GetFileCRC(filePath));
+        EXPECT_EQ(unknownFormatIndex.GetMissCount(), 1u);
+
+        // Malformed entries are skipped, well-formed ones are still used.
+        const AZStd::string content = AZStd::string::format(
+            "# ROS2 source assets CRC index v1: crc size modification_time path\n"
+            "12345 4\n"
+            "%u %llu %llu %s\n",
+            static_cast<AZ::u32>(ROS2::Utils::GetFileCRC(filePath)),
+            static_cast<unsigned long long>(AZ::IO::SystemFile::Length(filePath.c_str())),
+            static_cast<unsigned long long>(AZ::IO::SystemFile::ModificationTime(filePath.c_str())),
+            filePath.c_str());
+        WriteTestFile("SourceAssetsCrcIndex.txt", content);
+        ROS2::Utils::SourceAssetsCrcIndex malformedIndex(GetIndexFilePath());
+        EXPECT_TRUE(malformedIndex.Load());
+        EXPECT_EQ(malformedIndex.GetFileCRCs({ filePath }).front(), ROS2::Utils::GetFileCRC(filePath));
+        EXPECT_EQ(malformedIndex.GetHitCount(), 1u);
+    }
+} // namespace UnitTest
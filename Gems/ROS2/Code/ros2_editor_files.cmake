@@ -57,6 +57,8 @@ set(FILES
     Source/RobotImporter/URDF/VisualsMaker.h
     Source/RobotImporter/xacro/XacroUtils.cpp
     Source/RobotImporter/xacro/XacroUtils.h
+    Source/RobotImporter/Utils/AmentPackageIndex.cpp
+    Source/RobotImporter/Utils/AmentPackageIndex.h
     Source/RobotImporter/Utils/DefaultSolverConfiguration.h
     Source/RobotImporter/Utils/ErrorUtils.cpp
     Source/RobotImporter/Utils/ErrorUtils.h
@@ -64,6 +66,8 @@ set(FILES
     Source/RobotImporter/Utils/FilePath.h
     Source/RobotImporter/Utils/RobotImporterUtils.cpp
     Source/RobotImporter/Utils/RobotImporterUtils.h
+    Source/RobotImporter/Utils/SourceAssetsCrcIndex.cpp
+    Source/RobotImporter/Utils/SourceAssetsCrcIndex.h
     Source/RobotImporter/Utils/SourceAssetsStorage.cpp
     Source/RobotImporter/Utils/SourceAssetsStorage.h
     Source/RobotImporter/Utils/TypeConversions.cpp
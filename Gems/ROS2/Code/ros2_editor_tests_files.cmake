@@ -4,7 +4,9 @@
 # SPDX-License-Identifier: Apache-2.0 OR MIT
 
 set(FILES
+    Tests/AmentPackageIndexTest.cpp
     Tests/ROS2EditorTest.cpp
     Tests/SdfParserTest.cpp
+    Tests/SourceAssetsCrcIndexTest.cpp
     Tests/UrdfParserTest.cpp
 )
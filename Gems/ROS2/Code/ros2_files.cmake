@@ -10,14 +10,25 @@ set(FILES
         ../Assets/Passes/PipelineROSDepth.pass
         ../Assets/Passes/ROSPassTemplates.azasset
         Source/Camera/CameraConstants.h
+        Source/Camera/CameraFrameWorkerPool.cpp
+        Source/Camera/CameraFrameWorkerPool.h
+        Source/Camera/CameraImageEncoding.cpp
+        Source/Camera/CameraImageEncoding.h
+        Source/Camera/CameraMessagePool.h
+        Source/Camera/CameraPointCloud.cpp
+        Source/Camera/CameraPointCloud.h
         Source/Camera/CameraPublishers.cpp
         Source/Camera/CameraPublishers.h
+        Source/Camera/CameraRenderPipeline.cpp
+        Source/Camera/CameraRenderPipeline.h
         Source/Camera/CameraSensor.cpp
         Source/Camera/CameraSensor.h
         Source/Camera/CameraSensorDescription.cpp
         Source/Camera/CameraSensorDescription.h
         Source/Camera/CameraSensorConfiguration.cpp
         Source/Camera/CameraSensorConfiguration.h
+        Source/Camera/CameraSharedResources.cpp
+        Source/Camera/CameraSharedResources.h
         Source/Camera/ROS2CameraSensorComponent.cpp
         Source/Camera/ROS2CameraSensorComponent.h
         Source/Camera/CameraUtilities.cpp
@@ -54,6 +65,8 @@ set(FILES
         Source/Lidar/LidarRaycaster.h
         Source/Lidar/LidarRegistrarSystemComponent.cpp
         Source/Lidar/LidarRegistrarSystemComponent.h
+        Source/Lidar/LidarScheduler.cpp
+        Source/Lidar/LidarScheduler.h
         Source/Lidar/LidarSensorConfiguration.cpp
         Source/Lidar/LidarSensorConfiguration.h
         Source/Lidar/LidarSystem.cpp
@@ -64,6 +77,9 @@ set(FILES
         Source/Lidar/LidarTemplateUtils.h
         Source/Lidar/LidarCore.cpp
         Source/Lidar/LidarCore.h
+        Source/Lidar/PointCloudLayout.h
+        Source/Lidar/PointCloudMessageBuilder.cpp
+        Source/Lidar/PointCloudMessageBuilder.h
         Source/Lidar/ROS2Lidar2DSensorComponent.cpp
         Source/Lidar/ROS2Lidar2DSensorComponent.h
         Source/Lidar/ROS2LidarSensorComponent.cpp
@@ -114,6 +130,8 @@ set(FILES
         Source/Sensor/Events/TickBasedSource.cpp
         Source/Sensor/ROS2SensorComponent.cpp
         Source/Sensor/SensorConfiguration.cpp
+        Source/Sensor/SensorScheduler.cpp
+        Source/Sensor/SensorScheduler.h
         Source/SimulationUtils/FollowingCameraConfiguration.cpp
         Source/SimulationUtils/FollowingCameraConfiguration.h
         Source/SimulationUtils/FollowingCameraComponent.cpp
@@ -134,6 +152,7 @@ set(FILES
         Source/Utilities/PhysicsCallbackHandler.cpp
         Source/Utilities/ROS2Conversions.cpp
         Source/Utilities/ROS2Names.cpp
+        Source/Utilities/SharedResourceCache.h
         Source/VehicleDynamics/AxleConfiguration.cpp
         Source/VehicleDynamics/AxleConfiguration.h
         Source/VehicleDynamics/DriveModel.cpp
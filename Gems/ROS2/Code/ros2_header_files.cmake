@@ -8,6 +8,7 @@ set(FILES
         Include/ROS2/Camera/CameraPostProcessingRequestBus.h
         Include/ROS2/Clock/PhysicallyStableClock.h
         Include/ROS2/Clock/SimulationClock.h
+        Include/ROS2/Clock/SlidingWindowPercentiles.h
         Include/ROS2/Communication/PublisherConfiguration.h
         Include/ROS2/Communication/TopicConfiguration.h
         Include/ROS2/Communication/QoS.h
@@ -39,7 +40,9 @@ set(FILES
         Include/ROS2/Sensor/ROS2SensorComponent.h
         Include/ROS2/Sensor/ROS2SensorComponentBase.h
         Include/ROS2/Sensor/SensorConfiguration.h
+        Include/ROS2/Sensor/SensorSchedulerBus.h
         Include/ROS2/Spawner/SpawnerBus.h
+        Include/ROS2/Utilities/ConcurrencyUtilities.h
         Include/ROS2/Utilities/Controllers/PidConfiguration.h
         Include/ROS2/Utilities/PhysicsCallbackHandler.h
         Include/ROS2/Utilities/ROS2Conversions.h
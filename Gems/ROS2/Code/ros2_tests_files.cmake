@@ -5,5 +5,12 @@
 
 set(FILES
     Tests/ROS2Test.cpp
+    Tests/CameraFrameWorkerPoolTest.cpp
+    Tests/CameraImageEncodingTest.cpp
+    Tests/CameraPointCloudTest.cpp
+    Tests/ConcurrencyUtilitiesTest.cpp
     Tests/GNSSTest.cpp
+    Tests/LidarTemplateUtilsTest.cpp
+    Tests/SensorSchedulerTest.cpp
+    Tests/SlidingWindowPercentilesTest.cpp
 )
@@ -20,10 +20,11 @@ namespace WarehouseAutomation
         static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
         static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
 
-        //! Notify that a particular sensor is detecting an object (notification published for each frequency tick).
+        //! Notify that a particular sensor started detecting an object (notification published when the state changes).
         virtual void OnObjectInRange() = 0;
 
-        //! Notify that a particular sensor is not detecting an object (notification published for each frequency tick).
+        //! Notify that a particular sensor stopped detecting an object (notification published when the state changes).
+        //! Sensors start with no object in range, so this is not published before the first detection.
         virtual void OnObjectOutOfRange() = 0;
 
     protected:
@@ -37,14 +37,15 @@ namespace WarehouseAutomation
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<ConveyorBeltComponentConfiguration>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("BeltEntityId", &ConveyorBeltComponentConfiguration::m_conveyorEntityId)
                 ->Field("Speed", &ConveyorBeltComponentConfiguration::m_speed)
                 ->Field("BeltWidth", &ConveyorBeltComponentConfiguration::m_beltWidth)
                 ->Field("SegmentSize", &ConveyorBeltComponentConfiguration::m_segmentSize)
                 ->Field("TextureScale", &ConveyorBeltComponentConfiguration::m_textureScale)
                 ->Field("MaterialAsset", &ConveyorBeltComponentConfiguration::m_materialAsset)
-                ->Field("GraphicalMaterialSlot", &ConveyorBeltComponentConfiguration::m_graphicalMaterialSlot);
+                ->Field("GraphicalMaterialSlot", &ConveyorBeltComponentConfiguration::m_graphicalMaterialSlot)
+                ->Field("RecycleSegments", &ConveyorBeltComponentConfiguration::m_recycleSegments);
 
             if (AZ::EditContext* ec = serializeContext->GetEditContext())
             {
@@ -84,7 +85,13 @@ namespace WarehouseAutomation
                     ->Attribute(AZ::Edit::Attributes::DefaultAsset, &Internal::GetDefaultPhysicsMaterialAssetId)
                     ->Attribute(AZ_CRC_CE("EditButton"), "")
                     ->Attribute(AZ_CRC_CE("EditDescription"), "Open in Asset Editor")
-                    ->Attribute(AZ_CRC_CE("DisableEditButtonWhenNoAssetSelected"), true);
+                    ->Attribute(AZ_CRC_CE("DisableEditButtonWhenNoAssetSelected"), true)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &ConveyorBeltComponentConfiguration::m_recycleSegments,
+                        "Recycle segments",
+                        "Keep a fixed number of simulated segments and move segments leaving the belt back to its start, "
+                        "instead of creating and removing physics bodies.");
             }
         }
     }
@@ -27,5 +27,6 @@ namespace WarehouseAutomation
         AZ::EntityId m_conveyorEntityId; //!< Conveyor belt entity (used for texture movement)
         float m_textureScale = 1.0f; //!< Scaling factor of the texture
         float m_speed = 1.0f; //!< Initial speed of the conveyor belt
+        bool m_recycleSegments = false; //!< Keep a fixed ring of segments and move segments leaving the belt back to its start
     };
 } // namespace WarehouseAutomation
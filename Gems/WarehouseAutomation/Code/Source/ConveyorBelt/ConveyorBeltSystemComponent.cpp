@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "ConveyorBeltSystemComponent.h"
+#include <AtomLyIntegration/CommonFeatures/Material/MaterialComponentBus.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
+#include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
+#include <AzFramework/Physics/Shape.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
+#include <ROS2/Utilities/ConcurrencyUtilities.h>
+
+namespace WarehouseAutomation
+{
+    namespace
+    {
+        constexpr AZStd::string_view BeltsPerJobConfigurationKey = "/O3DE/WarehouseAutomation/ConveyorBelt/BeltsPerJob";
+        constexpr AZ::u64 DefaultBeltsPerJob = 16;
+    } // namespace
+
+    ConveyorBeltSystemComponent::ConveyorBeltSystemComponent()
+    {
+        if (!ConveyorBeltSystemInterface::Get())
+        {
+            ConveyorBeltSystemInterface::Register(this);
+        }
+    }
+
+    ConveyorBeltSystemComponent::~ConveyorBeltSystemComponent()
+    {
+        if (ConveyorBeltSystemInterface::Get() == this)
+        {
+            ConveyorBeltSystemInterface::Unregister(this);
+        }
+    }
+
+    void ConveyorBeltSystemComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<ConveyorBeltSystemComponent, AZ::Component>()->Version(0);
+
+            if (AZ::EditContext* editContext = serializeContext->GetEditContext())
+            {
+                editContext->Class<ConveyorBeltSystemComponent>("Conveyor Belt System", "Simulates all conveyor belts.")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("System"))
+                    ->Attribute(AZ::Edit::Attributes::Category, "WarehouseAutomation")
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true);
+            }
+        }
+    }
+
+    void ConveyorBeltSystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("ConveyorBeltSystemService"));
+    }
+
+    void ConveyorBeltSystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("ConveyorBeltSystemService"));
+    }
+
+    void ConveyorBeltSystemComponent::Activate()
+    {
+        m_beltsPerJob = DefaultBeltsPerJob;
+        if (auto* registry = AZ::SettingsRegistry::Get())
+        {
+            registry->Get(m_beltsPerJob, BeltsPerJobConfigurationKey);
+        }
+
+        m_sceneFinishSimHandler = AzPhysics::SceneEvents::OnSceneSimulationFinishHandler(
+            [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
+            {
+                OnSceneSimulationFinish(fixedDeltaTime);
+            },
+            aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Components));
+    }
+
+    void ConveyorBeltSystemComponent::Deactivate()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        m_sceneFinishSimHandler.Disconnect();
+        for (auto& belt : m_belts)
+        {
+            RemoveSegments(belt);
+        }
+        m_belts.clear();
+        m_beltIndices.clear();
+    }
+
+    void ConveyorBeltSystemComponent::RegisterBelt(
+        AZ::EntityId beltEntityId,
+        const ConveyorBeltComponentConfiguration& configuration,
+        const AZ::Spline& spline,
+        const AZ::Transform& splineTransform)
+    {
+        AZ_Assert(!m_beltIndices.contains(beltEntityId), "Belt %s is already registered", beltEntityId.ToString().c_str());
+        if (m_beltIndices.contains(beltEntityId))
+        {
+            return;
+        }
+
+        // The physics scene does not exist yet when system components are activated, so the handler is connected
+        // with the first belt.
+        if (!m_sceneFinishSimHandler.IsConnected())
+        {
+            AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+            AZ_Assert(sceneInterface, "No scene interface");
+            m_sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+            AZ_Assert(m_sceneHandle != AzPhysics::InvalidSceneHandle, "Invalid default physics scene handle");
+            sceneInterface->RegisterSceneSimulationFinishHandler(m_sceneHandle, m_sceneFinishSimHandler);
+            AZ::TickBus::Handler::BusConnect();
+        }
+
+        m_beltIndices[beltEntityId] = m_belts.size();
+        Belt& belt = m_belts.emplace_back();
+        belt.m_entityId = beltEntityId;
+        belt.m_configuration = configuration;
+        BuildSplineTable(belt, spline, splineTransform);
+        CreateSegments(belt);
+    }
+
+    void ConveyorBeltSystemComponent::UnregisterBelt(AZ::EntityId beltEntityId)
+    {
+        auto indexIt = m_beltIndices.find(beltEntityId);
+        if (indexIt == m_beltIndices.end())
+        {
+            return;
+        }
+        const size_t index = indexIt->second;
+        m_beltIndices.erase(indexIt);
+        RemoveSegments(m_belts[index]);
+
+        // keep belts contiguous by moving the last belt into the freed slot
+        if (index != m_belts.size() - 1)
+        {
+            m_belts[index] = AZStd::move(m_belts.back());
+            m_beltIndices[m_belts[index].m_entityId] = index;
+        }
+        m_belts.pop_back();
+
+        if (m_belts.empty())
+        {
+            m_sceneFinishSimHandler.Disconnect();
+            AZ::TickBus::Handler::BusDisconnect();
+        }
+    }
+
+    void ConveyorBeltSystemComponent::UpdateBeltSpline(
+        AZ::EntityId beltEntityId, const AZ::Spline& spline, const AZ::Transform& splineTransform)
+    {
+        if (Belt* belt = FindBelt(beltEntityId))
+        {
+            // Normalized locations of segments depend on the spline length, so segments are created anew.
+            RemoveSegments(*belt);
+            BuildSplineTable(*belt, spline, splineTransform);
+            CreateSegments(*belt);
+        }
+    }
+
+    void ConveyorBeltSystemComponent::SetBeltGraphicalMaterial(
+        AZ::EntityId beltEntityId, const AZ::Render::MaterialAssignmentId& materialId)
+    {
+        if (Belt* belt = FindBelt(beltEntityId))
+        {
+            belt->m_graphicalMaterialId = materialId;
+        }
+    }
+
+    void ConveyorBeltSystemComponent::SetBeltStopped(AZ::EntityId beltEntityId, bool stopped)
+    {
+        if (Belt* belt = FindBelt(beltEntityId))
+        {
+            belt->m_stopped = stopped;
+        }
+    }
+
+    bool ConveyorBeltSystemComponent::IsBeltStopped(AZ::EntityId beltEntityId) const
+    {
+        const Belt* belt = FindBelt(beltEntityId);
+        return belt && belt->m_stopped;
+    }
+
+    ConveyorBeltSystemComponent::Belt* ConveyorBeltSystemComponent::FindBelt(AZ::EntityId beltEntityId)
+    {
+        auto indexIt = m_beltIndices.find(beltEntityId);
+        return indexIt != m_beltIndices.end() ? &m_belts[indexIt->second] : nullptr;
+    }
+
+    const ConveyorBeltSystemComponent::Belt* ConveyorBeltSystemComponent::FindBelt(AZ::EntityId beltEntityId) const
+    {
+        auto indexIt = m_beltIndices.find(beltEntityId);
+        return indexIt != m_beltIndices.end() ? &m_belts[indexIt->second] : nullptr;
+    }
+
+    void ConveyorBeltSystemComponent::OnSceneSimulationFinish(float fixedDeltaTime)
+    {
+        // Segments are added to and removed from the scene serially, as these modify the scene.
+        for (auto& belt : m_belts)
+        {
+            if (belt.m_configuration.m_recycleSegments)
+            {
+                RecycleSegments(belt);
+            }
+            else
+            {
+                SpawnSegments(belt, fixedDeltaTime);
+            }
+        }
+
+        // Computing targets touches only the belt's own data, so belts are split between jobs.
+        const size_t beltsPerJob = aznumeric_cast<size_t>(m_beltsPerJob);
+        const size_t maxJobCount = beltsPerJob == 0 ? 1 : (m_belts.size() + beltsPerJob - 1) / beltsPerJob;
+        ROS2::ConcurrencyUtilities::ForEachConcurrently(
+            m_belts.size(),
+            maxJobCount,
+            [this, fixedDeltaTime](size_t beltIndex)
+            {
+                ComputeSegmentTargets(m_belts[beltIndex], fixedDeltaTime);
+            });
+
+        for (auto& belt : m_belts)
+        {
+            if (!belt.m_stopped)
+            {
+                for (size_t segmentIndex = 0; segmentIndex < belt.m_segmentBodies.size(); ++segmentIndex)
+                {
+                    belt.m_segmentBodies[segmentIndex]->SetKinematicTarget(belt.m_segmentTargets[segmentIndex]);
+                }
+            }
+            if (!belt.m_configuration.m_recycleSegments)
+            {
+                DespawnSegments(belt);
+            }
+        }
+    }
+
+    void ConveyorBeltSystemComponent::ComputeSegmentTargets(Belt& belt, float fixedDeltaTime)
+    {
+        if (belt.m_stopped)
+        { // Do not move segments when stopped
+            return;
+        }
+
+        const float normalizedDistanceDelta = belt.m_configuration.m_speed * fixedDeltaTime / belt.m_splineTable.GetLength();
+        belt.m_segmentTargets.resize(belt.m_segmentLocations.size());
+        for (size_t segmentIndex = 0; segmentIndex < belt.m_segmentLocations.size(); ++segmentIndex)
+        {
+            float& location = belt.m_segmentLocations[segmentIndex];
+            location += normalizedDistanceDelta;
+            belt.m_segmentTargets[segmentIndex] = belt.m_splineTable.GetTransform(location);
+        }
+    }
+
+    void ConveyorBeltSystemComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        // Animate textures
+        for (auto& belt : m_belts)
+        {
+            if (belt.m_stopped || !belt.m_configuration.m_conveyorEntityId.IsValid())
+            {
+                continue;
+            }
+
+            belt.m_textureOffset += deltaTime * belt.m_configuration.m_speed * belt.m_configuration.m_textureScale;
+            AZ::Render::MaterialComponentRequestBus::Event(
+                belt.m_configuration.m_conveyorEntityId,
+                &AZ::Render::MaterialComponentRequestBus::Events::SetPropertyValueT<float>,
+                belt.m_graphicalMaterialId,
+                "uv.offsetU",
+                belt.m_textureOffset);
+        }
+    }
+
+    void ConveyorBeltSystemComponent::BuildSplineTable(Belt& belt, const AZ::Spline& spline, const AZ::Transform& splineTransform)
+    {
+        belt.m_splineTable.Build(
+            spline, splineTransform, -AZ::Vector3::CreateAxisZ(belt.m_configuration.m_segmentSize / 2.f), SplineSampleDistance);
+    }
+
+    void ConveyorBeltSystemComponent::CreateSegments(Belt& belt)
+    {
+        const float splineLength = belt.m_splineTable.GetLength();
+        AZ_Assert(splineLength != 0.0f, "splineLength must be non-zero");
+        const float normalizedDistanceStep = SegmentSeparation * belt.m_configuration.m_segmentSize / splineLength;
+        size_t segmentCount = 0;
+        for (float normalizedIndex = 0.f; normalizedIndex < 1.f + normalizedDistanceStep; normalizedIndex += normalizedDistanceStep)
+        {
+            CreateSegment(belt, normalizedIndex);
+            ++segmentCount;
+        }
+        // In recycling mode these segments are all the belt will ever have, spaced evenly along a ring that is
+        // slightly longer than the spline, so one segment is always about to enter the belt.
+        belt.m_segmentsRingLength = aznumeric_cast<float>(segmentCount) * normalizedDistanceStep;
+        AZ_Printf("ConveyorBeltSystemComponent", "Initial Number of segments: %zu", belt.m_segmentHandles.size());
+    }
+
+    void ConveyorBeltSystemComponent::CreateSegment(Belt& belt, float normalizedLocation)
+    {
+        AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        AZ_Assert(sceneInterface != nullptr, "Unable to get Scene Interface");
+
+        auto colliderConfiguration = AZStd::make_shared<Physics::ColliderConfiguration>();
+        colliderConfiguration->m_isInSceneQueries = false;
+        colliderConfiguration->m_materialSlots.SetMaterialAsset(0, belt.m_configuration.m_materialAsset);
+        colliderConfiguration->m_rotation = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3::CreateAxisX(), AZ::DegToRad(90.0f));
+        auto shapeConfiguration = AZStd::make_shared<Physics::CapsuleShapeConfiguration>(
+            belt.m_configuration.m_beltWidth, belt.m_configuration.m_segmentSize / 2.0f);
+        const auto transform = belt.m_splineTable.GetTransform(normalizedLocation);
+        AzPhysics::RigidBodyConfiguration conveyorSegmentRigidBodyConfig;
+        conveyorSegmentRigidBodyConfig.m_kinematic = true;
+        conveyorSegmentRigidBodyConfig.m_position = transform.GetTranslation();
+        conveyorSegmentRigidBodyConfig.m_orientation = transform.GetRotation();
+        conveyorSegmentRigidBodyConfig.m_colliderAndShapeData = AzPhysics::ShapeColliderPair(colliderConfiguration, shapeConfiguration);
+        conveyorSegmentRigidBodyConfig.m_computeCenterOfMass = true;
+        conveyorSegmentRigidBodyConfig.m_computeInertiaTensor = true;
+        conveyorSegmentRigidBodyConfig.m_startSimulationEnabled = true;
+        conveyorSegmentRigidBodyConfig.m_computeMass = false;
+        conveyorSegmentRigidBodyConfig.m_mass = 1.0f;
+        conveyorSegmentRigidBodyConfig.m_entityId = belt.m_entityId;
+        conveyorSegmentRigidBodyConfig.m_debugName = "ConveyorBeltSegment";
+        AzPhysics::SimulatedBodyHandle handle = sceneInterface->AddSimulatedBody(m_sceneHandle, &conveyorSegmentRigidBodyConfig);
+        auto* body = azdynamic_cast<AzPhysics::RigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(m_sceneHandle, handle));
+        if (!body)
+        {
+            if (handle != AzPhysics::InvalidSimulatedBodyHandle)
+            {
+                sceneInterface->RemoveSimulatedBody(m_sceneHandle, handle);
+            }
+            return;
+        }
+        belt.m_segmentLocations.push_back(normalizedLocation);
+        belt.m_segmentHandles.push_back(handle);
+        belt.m_segmentBodies.push_back(body);
+        belt.m_segmentTargets.push_back(transform);
+    }
+
+    void ConveyorBeltSystemComponent::RemoveSegments(Belt& belt)
+    {
+        AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if (sceneInterface)
+        {
+            for (auto& handle : belt.m_segmentHandles)
+            {
+                sceneInterface->RemoveSimulatedBody(m_sceneHandle, handle);
+            }
+        }
+        belt.m_segmentLocations.clear();
+        belt.m_segmentHandles.clear();
+        belt.m_segmentBodies.clear();
+        belt.m_segmentTargets.clear();
+    }
+
+    void ConveyorBeltSystemComponent::SpawnSegments(Belt& belt, float deltaTime)
+    {
+        // Find normalized spawn place (0.0 or 1.0) depending on movement direction
+        const float spawnPlaceNormalized = static_cast<float>(belt.m_configuration.m_speed < 0.0f);
+        belt.m_deltaTimeFromLastSpawn += deltaTime;
+        if (belt.m_segmentHandles.empty())
+        {
+            CreateSegment(belt, spawnPlaceNormalized);
+            return;
+        }
+        if (belt.m_deltaTimeFromLastSpawn >
+            SegmentSeparation * belt.m_configuration.m_segmentSize / AZStd::abs(belt.m_configuration.m_speed))
+        {
+            belt.m_deltaTimeFromLastSpawn = 0.f;
+            CreateSegment(belt, spawnPlaceNormalized);
+        }
+    }
+
+    void ConveyorBeltSystemComponent::DespawnSegments(Belt& belt)
+    {
+        AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        const bool positiveDirection = belt.m_configuration.m_speed > 0.0f;
+
+        // compact segment arrays in place, removing segments that left the spline
+        size_t keptCount = 0;
+        for (size_t segmentIndex = 0; segmentIndex < belt.m_segmentLocations.size(); ++segmentIndex)
+        {
+            const float location = belt.m_segmentLocations[segmentIndex];
+            if ((positiveDirection && location > 1.0f) || (!positiveDirection && location < 0.0f))
+            {
+                sceneInterface->RemoveSimulatedBody(m_sceneHandle, belt.m_segmentHandles[segmentIndex]);
+                continue;
+            }
+            if (keptCount != segmentIndex)
+            {
+                belt.m_segmentLocations[keptCount] = location;
+                belt.m_segmentHandles[keptCount] = belt.m_segmentHandles[segmentIndex];
+                belt.m_segmentBodies[keptCount] = belt.m_segmentBodies[segmentIndex];
+                belt.m_segmentTargets[keptCount] = belt.m_segmentTargets[segmentIndex];
+            }
+            ++keptCount;
+        }
+        belt.m_segmentLocations.resize(keptCount);
+        belt.m_segmentHandles.resize(keptCount);
+        belt.m_segmentBodies.resize(keptCount);
+        belt.m_segmentTargets.resize(keptCount);
+    }
+
+    void ConveyorBeltSystemComponent::RecycleSegments(Belt& belt)
+    {
+        const bool positiveDirection = belt.m_configuration.m_speed > 0.0f;
+        for (size_t segmentIndex = 0; segmentIndex < belt.m_segmentLocations.size(); ++segmentIndex)
+        {
+            float& location = belt.m_segmentLocations[segmentIndex];
+            if ((positiveDirection && location > 1.0f) || (!positiveDirection && location < 0.0f))
+            {
+                location += positiveDirection ? -belt.m_segmentsRingLength : belt.m_segmentsRingLength;
+                // Teleport instead of setting a kinematic target, so the segment does not sweep through the belt's load.
+                belt.m_segmentBodies[segmentIndex]->SetTransform(belt.m_splineTable.GetTransform(location));
+            }
+        }
+    }
+} // namespace WarehouseAutomation
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include "ConveyorBeltSystemInterface.h"
+#include "SplineArcLengthTable.h"
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/Common/PhysicsTypes.h>
+#include <AzFramework/Physics/RigidBody.h>
+
+namespace WarehouseAutomation
+{
+    //! System component that simulates all conveyor belts.
+    //! Segments of every belt are kept in contiguous arrays and all belts are stepped in a single physics callback,
+    //! so the per-belt cost is not dominated by handler dispatch and body lookups.
+    //! Kinematic targets are computed in parallel when there are more belts than
+    //! /O3DE/WarehouseAutomation/ConveyorBelt/BeltsPerJob (0 disables the job system).
+    //! Texture offsets of all belts are updated in a single tick handler.
+    class ConveyorBeltSystemComponent
+        : public AZ::Component
+        , public AZ::TickBus::Handler
+        , protected ConveyorBeltSystemRequests
+    {
+        static constexpr float SegmentSeparation = 1.0f; //!< Separation between segments of the belt (in normalized units)
+        static constexpr float SplineSampleDistance = 0.05f; //!< Distance between samples of the spline arc-length table (in meters)
+
+    public:
+        AZ_COMPONENT(ConveyorBeltSystemComponent, "{8d8e73d5-be0c-432b-b608-380e0679f734}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        ConveyorBeltSystemComponent();
+        ~ConveyorBeltSystemComponent();
+
+    protected:
+        // AZ::Component overrides
+        void Activate() override;
+        void Deactivate() override;
+
+        // AZ::TickBus::Handler overrides
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        // ConveyorBeltSystemRequests overrides
+        void RegisterBelt(
+            AZ::EntityId beltEntityId,
+            const ConveyorBeltComponentConfiguration& configuration,
+            const AZ::Spline& spline,
+            const AZ::Transform& splineTransform) override;
+        void UnregisterBelt(AZ::EntityId beltEntityId) override;
+        void UpdateBeltSpline(AZ::EntityId beltEntityId, const AZ::Spline& spline, const AZ::Transform& splineTransform) override;
+        void SetBeltGraphicalMaterial(AZ::EntityId beltEntityId, const AZ::Render::MaterialAssignmentId& materialId) override;
+        void SetBeltStopped(AZ::EntityId beltEntityId, bool stopped) override;
+        bool IsBeltStopped(AZ::EntityId beltEntityId) const override;
+
+    private:
+        //! Simulation state of a single belt.
+        //! Segment data is stored as parallel arrays, indexed by segment.
+        struct Belt
+        {
+            AZ::EntityId m_entityId; //!< Entity of the conveyor belt component
+            ConveyorBeltComponentConfiguration m_configuration; //!< Configuration of the belt
+            SplineArcLengthTable m_splineTable; //!< Poses along the spline, used to place segments
+            float m_segmentsRingLength = 0.0f; //!< Normalized distance covered by all segments in recycling mode
+            float m_deltaTimeFromLastSpawn = 0.0f; //!< Time since the last spawn
+            float m_textureOffset = 0.0f; //!< Current offset of the texture during animation
+            AZ::Render::MaterialAssignmentId m_graphicalMaterialId; //!< Material id of the animated belt
+            bool m_stopped = false; //!< State of the conveyor belt
+            AZStd::vector<float> m_segmentLocations; //!< Normalized locations of segments along the spline
+            AZStd::vector<AzPhysics::SimulatedBodyHandle> m_segmentHandles; //!< Handles of segments' simulated bodies
+            AZStd::vector<AzPhysics::RigidBody*> m_segmentBodies; //!< Segments' bodies, cached to avoid lookups every step
+            AZStd::vector<AZ::Transform> m_segmentTargets; //!< Kinematic targets of segments computed in the current step
+        };
+
+        //! Called after every physics sub-step, steps all belts.
+        void OnSceneSimulationFinish(float fixedDeltaTime);
+
+        //! Find a registered belt.
+        //! @return pointer to the belt, nullptr if the belt is not registered
+        Belt* FindBelt(AZ::EntityId beltEntityId);
+        const Belt* FindBelt(AZ::EntityId beltEntityId) const;
+
+        //! Sample the spline of the belt into its arc-length table
+        void BuildSplineTable(Belt& belt, const AZ::Spline& spline, const AZ::Transform& splineTransform);
+
+        //! Create segments evenly spaced along the whole belt
+        void CreateSegments(Belt& belt);
+
+        //! Add a kinematic rigid body for a new segment at the given normalized location
+        void CreateSegment(Belt& belt, float normalizedLocation);
+
+        //! Remove all segments of the belt from the physics scene
+        void RemoveSegments(Belt& belt);
+
+        //! Spawn segments with given rate of spawning
+        void SpawnSegments(Belt& belt, float deltaTime);
+
+        //! Despawn segments that are at the end of the spline
+        void DespawnSegments(Belt& belt);
+
+        //! Move segments that are at the end of the spline back to its start (recycling mode only)
+        void RecycleSegments(Belt& belt);
+
+        //! Advance segments of the belt and compute their kinematic targets. Does not access the physics scene.
+        static void ComputeSegmentTargets(Belt& belt, float fixedDeltaTime);
+
+        AZStd::vector<Belt> m_belts; //!< All registered belts
+        AZStd::unordered_map<AZ::EntityId, size_t> m_beltIndices; //!< Indices of belts in m_belts
+        AzPhysics::SceneHandle m_sceneHandle = AzPhysics::InvalidSceneHandle; //!< Scene handle of the scene the belts are in
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_sceneFinishSimHandler; //!< Handler called after every physics sub-step
+        AZ::u64 m_beltsPerJob = 0; //!< Number of belts stepped by a single job on average, 0 if the job system is not used
+    };
+} // namespace WarehouseAutomation
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include "ConveyorBeltComponentConfiguration.h"
+#include <AtomLyIntegration/CommonFeatures/Material/MaterialAssignmentId.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Spline.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/RTTI/RTTI.h>
+
+namespace WarehouseAutomation
+{
+    //! Interface of the ConveyorBeltSystemComponent, which simulates all conveyor belts.
+    //! Belts are identified by the entity of their ConveyorBeltComponent.
+    class ConveyorBeltSystemRequests
+    {
+    public:
+        AZ_RTTI(ConveyorBeltSystemRequests, "{75b409ed-4a19-46cf-9a1b-c749321b7ae5}");
+
+        //! Register a belt and create its segments.
+        //! @param beltEntityId entity of the conveyor belt component
+        //! @param configuration configuration of the belt
+        //! @param spline spline of the belt, in spline's local frame
+        //! @param splineTransform transform from spline's local frame to world frame
+        virtual void RegisterBelt(
+            AZ::EntityId beltEntityId,
+            const ConveyorBeltComponentConfiguration& configuration,
+            const AZ::Spline& spline,
+            const AZ::Transform& splineTransform) = 0;
+
+        //! Remove segments of the belt and stop simulating it.
+        //! @param beltEntityId entity of the conveyor belt component
+        virtual void UnregisterBelt(AZ::EntityId beltEntityId) = 0;
+
+        //! Resample the spline of a registered belt and create its segments anew.
+        //! @param beltEntityId entity of the conveyor belt component
+        //! @param spline spline of the belt, in spline's local frame
+        //! @param splineTransform transform from spline's local frame to world frame
+        virtual void UpdateBeltSpline(AZ::EntityId beltEntityId, const AZ::Spline& spline, const AZ::Transform& splineTransform) = 0;
+
+        //! Set the material of the belt whose texture is animated.
+        //! @param beltEntityId entity of the conveyor belt component
+        //! @param materialId material slot of the conveyor entity
+        virtual void SetBeltGraphicalMaterial(AZ::EntityId beltEntityId, const AZ::Render::MaterialAssignmentId& materialId) = 0;
+
+        //! Start or stop a registered belt.
+        //! @param beltEntityId entity of the conveyor belt component
+        //! @param stopped true to stop the belt
+        virtual void SetBeltStopped(AZ::EntityId beltEntityId, bool stopped) = 0;
+
+        //! Query whether a belt is stopped.
+        //! @param beltEntityId entity of the conveyor belt component
+        //! @return true if the belt is registered and stopped
+        virtual bool IsBeltStopped(AZ::EntityId beltEntityId) const = 0;
+
+    protected:
+        ~ConveyorBeltSystemRequests() = default;
+    };
+
+    using ConveyorBeltSystemInterface = AZ::Interface<ConveyorBeltSystemRequests>;
+} // namespace WarehouseAutomation
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "SplineArcLengthTable.h"
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Matrix3x3.h>
+#include <AzCore/std/math.h>
+
+namespace WarehouseAutomation
+{
+    void SplineArcLengthTable::Build(
+        const AZ::Spline& spline, const AZ::Transform& splineTransform, const AZ::Vector3& localOffset, float sampleDistance)
+    {
+        AZ_Assert(sampleDistance > 0.0f, "sampleDistance must be positive");
+        m_positions.clear();
+        m_rotations.clear();
+
+        m_length = spline.GetLength(spline.GetAddressByFraction(1.f));
+        const size_t sampleCount = AZStd::max(size_t{ 2 }, aznumeric_cast<size_t>(AZStd::ceil(m_length / sampleDistance)) + 1);
+        m_positions.reserve(sampleCount);
+        m_rotations.reserve(sampleCount);
+        for (size_t sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex)
+        {
+            const float distance = m_length * aznumeric_cast<float>(sampleIndex) / aznumeric_cast<float>(sampleCount - 1);
+            const AZ::SplineAddress address = spline.GetAddressByDistance(distance);
+            const AZ::Vector3 p = spline.GetPosition(address);
+
+            // A zero-length spline has no tangent, so its samples keep the orientation of the spline.
+            AZ::Matrix3x3 rotationMatrix = AZ::Matrix3x3::CreateIdentity();
+            if (m_length > AZ::Constants::FloatEpsilon)
+            {
+                // construct the rotation matrix from three orthogonal vectors.
+                const AZ::Vector3 v1 = spline.GetTangent(address);
+                const AZ::Vector3 v2 = spline.GetNormal(address);
+                const AZ::Vector3 v3 = v1.Cross(v2);
+
+                rotationMatrix = AZ::Matrix3x3::CreateFromColumns(v1, v2, v3);
+                AZ_Assert(rotationMatrix.IsOrthogonal(0.001f), "Rotation matrix is not orthogonal");
+                rotationMatrix.Orthogonalize();
+            }
+            const AZ::Transform transform =
+                splineTransform * AZ::Transform::CreateFromMatrix3x3AndTranslation(rotationMatrix, p + localOffset);
+            m_positions.push_back(transform.GetTranslation());
+            m_rotations.push_back(transform.GetRotation());
+        }
+    }
+
+    AZ::Transform SplineArcLengthTable::GetTransform(float distanceNormalized) const
+    {
+        if (m_positions.empty())
+        {
+            return AZ::Transform::CreateIdentity();
+        }
+        const float sample = AZ::GetClamp(distanceNormalized, 0.0f, 1.0f) * aznumeric_cast<float>(m_positions.size() - 1);
+        const size_t index = AZStd::min(aznumeric_cast<size_t>(sample), m_positions.size() - 2);
+        const float t = sample - aznumeric_cast<float>(index);
+        return AZ::Transform::CreateFromQuaternionAndTranslation(
+            m_rotations[index].NLerp(m_rotations[index + 1], t), m_positions[index].Lerp(m_positions[index + 1], t));
+    }
+
+    float SplineArcLengthTable::GetLength() const
+    {
+        return m_length;
+    }
+
+    bool SplineArcLengthTable::IsEmpty() const
+    {
+        return m_positions.empty();
+    }
+} // namespace WarehouseAutomation
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Spline.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace WarehouseAutomation
+{
+    //! Poses along a spline, sampled at uniform arc-length intervals.
+    //! Sampling the table is O(1) and, unlike sampling the spline by fraction, the normalized distance is proportional
+    //! to the distance traveled along the spline, so objects moved at constant normalized speed keep a constant speed.
+    class SplineArcLengthTable
+    {
+    public:
+        //! Sample the spline. A zero-length spline is sampled at its only position, with the orientation of the spline transform.
+        //! @param spline the spline to sample
+        //! @param splineTransform transform from spline's local frame to world frame
+        //! @param localOffset offset of every pose, in spline's local frame
+        //! @param sampleDistance maximum distance between two consecutive samples
+        void Build(const AZ::Spline& spline, const AZ::Transform& splineTransform, const AZ::Vector3& localOffset, float sampleDistance);
+
+        //! Obtains the pose at the given distance, interpolated between the two nearest samples
+        //! @param distanceNormalized the distance along the spline (normalized to the spline length), clamped to [0, 1]
+        //! @return the pose in world space, identity if the table is empty
+        AZ::Transform GetTransform(float distanceNormalized) const;
+
+        //! Non-normalized length of the sampled spline
+        float GetLength() const;
+
+        //! Check if the table holds any samples
+        bool IsEmpty() const;
+
+    private:
+        float m_length = 0.0f; //!< Non-normalized length of the sampled spline
+        AZStd::vector<AZ::Vector3> m_positions; //!< Positions of samples in world space
+        AZStd::vector<AZ::Quaternion> m_rotations; //!< Rotations of samples in world space
+    };
+} // namespace WarehouseAutomation
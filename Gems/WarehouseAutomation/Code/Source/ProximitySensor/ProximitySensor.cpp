@@ -10,9 +10,11 @@
 #include "ProximitySensor.h"
 
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/std/math.h>
 #include <AzCore/std/string/string.h>
 
 #include <WarehouseAutomation/ProximitySensor/ProximitySensorNotificationBus.h>
@@ -21,10 +23,6 @@
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/Scene.h>
 
-#include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
-#include <AzFramework/Physics/Common/PhysicsTypes.h>
-#include <AzFramework/Physics/PhysicsScene.h>
-
 namespace WarehouseAutomation
 {
     void ProximitySensor::Reflect(AZ::ReflectContext* context)
@@ -32,10 +30,14 @@ namespace WarehouseAutomation
         if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serialize->Class<ProximitySensor, AZ::Component>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("visualize", &ProximitySensor::m_visualize)
                 ->Field("frequency", &ProximitySensor::m_frequency)
-                ->Field("detectionDistance", &ProximitySensor::m_detectionDistance);
+                ->Field("detectionDistance", &ProximitySensor::m_detectionDistance)
+                ->Field("rayPattern", &ProximitySensor::m_rayPattern)
+                ->Field("rayCount", &ProximitySensor::m_rayCount)
+                ->Field("fanAngle", &ProximitySensor::m_fanAngle)
+                ->Field("beamWidth", &ProximitySensor::m_beamWidth);
 
             if (AZ::EditContext* editContext = serialize->GetEditContext())
             {
@@ -51,7 +53,34 @@ namespace WarehouseAutomation
                         &ProximitySensor::m_detectionDistance,
                         "Detection distance",
                         "The maximum distance from where object is detected")
-                    ->Attribute(AZ::Edit::Attributes::Min, 0.f);
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(AZ::Edit::UIHandlers::ComboBox, &ProximitySensor::m_rayPattern, "Ray pattern", "Arrangement of rays")
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+                    ->EnumAttribute(ProximitySensor::RayPattern::Fan, "Fan")
+                    ->EnumAttribute(ProximitySensor::RayPattern::Beam, "Beam")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &ProximitySensor::m_rayCount,
+                        "Ray count",
+                        "Number of rays, an object is detected if any of them hits")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &ProximitySensor::m_fanAngle,
+                        "Fan angle",
+                        "Angle between outermost rays of the fan, 360 spreads rays evenly over a full circle")
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &ProximitySensor::IsFanAngleVisible)
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->Attribute(AZ::Edit::Attributes::Max, 360.f)
+                    ->Attribute(AZ::Edit::Attributes::Suffix, " deg")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &ProximitySensor::m_beamWidth,
+                        "Beam width",
+                        "Distance between outermost rays of the beam")
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &ProximitySensor::IsBeamWidthVisible)
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->Attribute(AZ::Edit::Attributes::Suffix, " m");
             }
         }
         if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
@@ -72,107 +101,121 @@ namespace WarehouseAutomation
         {
             auto* entityScene = AZ::RPI::Scene::GetSceneForEntityId(GetEntityId());
             m_drawQueue = AZ::RPI::AuxGeomFeatureProcessorInterface::GetDrawQueueForScene(entityScene);
+            AZ::TickBus::Handler::BusConnect();
         }
 
         AZ::Transform entityTransform;
         AZ::TransformBus::EventResult(entityTransform, GetEntityId(), &AZ::TransformBus::Events::GetWorldTM);
 
-        m_detectionDirection = entityTransform.TransformVector(AZ::Vector3::CreateAxisX());
-        m_detectionDirection.Normalize();
+        auto* proximitySensorSystem = ProximitySensorSystemInterface::Get();
+        AZ_Assert(proximitySensorSystem, "No proximity sensor system");
+        if (proximitySensorSystem)
+        {
+            ProximitySensorDescription description;
+            description.m_frequency = m_frequency;
+            description.m_detectionDistance = m_detectionDistance;
+            description.m_rays = GetRays(m_rayPattern, m_rayCount, m_fanAngle, m_beamWidth);
+            proximitySensorSystem->RegisterSensor(GetEntityId(), description, entityTransform);
+        }
 
-        AZ::TickBus::Handler::BusConnect();
+        AZ::TransformNotificationBus::Handler::BusConnect(GetEntityId());
     }
 
     void ProximitySensor::Deactivate()
     {
+        AZ::TransformNotificationBus::Handler::BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
+        if (auto* proximitySensorSystem = ProximitySensorSystemInterface::Get())
+        {
+            proximitySensorSystem->UnregisterSensor(GetEntityId());
+        }
     }
 
-    void ProximitySensor::Visualize()
+    void ProximitySensor::OnTransformChanged([[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
     {
-        if (m_drawQueue)
+        if (auto* proximitySensorSystem = ProximitySensorSystemInterface::Get())
         {
-            AZStd::vector<AZ::Vector3> linePoints;
-
-            AZ::Vector3 entityTranslation;
-            AZ::TransformBus::EventResult(entityTranslation, GetEntityId(), &AZ::TransformBus::Events::GetWorldTranslation);
-            AZ::RPI::AuxGeomDraw::AuxGeomDynamicDrawArguments drawArgs;
-
-            linePoints.push_back(entityTranslation);
-            if (m_position)
-            {
-                drawArgs.m_colors = &AZ::Colors::Green;
-                linePoints.push_back(m_position.value());
-            }
-            else
-            {
-                drawArgs.m_colors = &AZ::Colors::Red;
-                linePoints.push_back(entityTranslation + m_detectionDirection * m_detectionDistance);
-            }
-
-            const uint8_t pixelSize = 5;
-            drawArgs.m_verts = linePoints.data();
-            drawArgs.m_vertCount = linePoints.size();
-
-            drawArgs.m_colorCount = 1;
-            drawArgs.m_opacityType = AZ::RPI::AuxGeomDraw::OpacityType::Opaque;
-            drawArgs.m_size = pixelSize;
-            m_drawQueue->DrawLines(drawArgs);
+            proximitySensorSystem->SetSensorTransform(GetEntityId(), world);
         }
     }
 
-    void ProximitySensor::OnTick(float deltaTime, AZ::ScriptTimePoint time)
+    bool ProximitySensor::IsFanAngleVisible() const
     {
-        if (m_visualize)
-        {
-            Visualize();
-        }
+        return m_rayPattern == RayPattern::Fan;
+    }
 
-        AZ_Assert(m_frequency > 0.f, "ProximitySensor frequency must be greater than zero");
-        auto frameTime = 1.f / m_frequency;
+    bool ProximitySensor::IsBeamWidthVisible() const
+    {
+        return m_rayPattern == RayPattern::Beam;
+    }
 
-        m_timeElapsedSinceLastTick += deltaTime;
-        if (m_timeElapsedSinceLastTick < frameTime)
+    AZStd::vector<ProximitySensorRay> ProximitySensor::GetRays(RayPattern rayPattern, AZ::u32 rayCount, float fanAngle, float beamWidth)
+    {
+        rayCount = AZStd::max(rayCount, 1u);
+        AZStd::vector<ProximitySensorRay> rays(rayCount);
+        if (rayCount == 1)
         {
-            return;
+            return rays;
         }
 
-        m_timeElapsedSinceLastTick -= frameTime;
-        if (deltaTime > frameTime)
-        { // Frequency higher than possible, not catching
-          // up, just keep going with each frame.
-            m_timeElapsedSinceLastTick = 0.0f;
+        // A full circle fan has no outermost rays, spacing them over rayCount - 1 intervals would make the first and last coincide
+        const bool isFullCircle = rayPattern == RayPattern::Fan && fanAngle >= 360.f;
+        const AZ::u32 intervalCount = isFullCircle ? rayCount : rayCount - 1;
+        for (AZ::u32 rayIndex = 0; rayIndex < rayCount; ++rayIndex)
+        {
+            // spread rays evenly from -0.5 to 0.5 of the fan angle or beam width
+            const float spread = aznumeric_cast<float>(rayIndex) / aznumeric_cast<float>(intervalCount) - 0.5f;
+            if (rayPattern == RayPattern::Fan)
+            {
+                const float angle = AZ::DegToRad(fanAngle) * spread;
+                rays[rayIndex].m_direction = AZ::Vector3(AZStd::cos(angle), AZStd::sin(angle), 0.f);
+            }
+            else
+            {
+                rays[rayIndex].m_origin = AZ::Vector3::CreateAxisY(beamWidth * spread);
+            }
         }
-        DetectionCheck();
+        return rays;
     }
 
-    void ProximitySensor::DetectionCheck()
+    void ProximitySensor::Visualize()
     {
-        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
-
-        AZ::Vector3 entityTranslation;
-        AZ::TransformBus::EventResult(entityTranslation, GetEntityId(), &AZ::TransformBus::Events::GetWorldTranslation);
-
-        AzPhysics::RayCastRequest request;
-        request.m_start = entityTranslation;
-        request.m_direction = m_detectionDirection;
-        request.m_distance = m_detectionDistance;
-
-        if (AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
-            sceneHandle != AzPhysics::InvalidSceneHandle)
+        auto* proximitySensorSystem = ProximitySensorSystemInterface::Get();
+        if (m_drawQueue && proximitySensorSystem)
         {
-            AzPhysics::SceneQueryHits result = sceneInterface->QueryScene(sceneHandle, &request);
-
-            m_position = !result.m_hits.empty() ? std::make_optional(result.m_hits.front().m_position) : std::nullopt;
+            AZStd::vector<AZ::Vector3> hitLinePoints;
+            AZStd::vector<AZ::Vector3> missLinePoints;
+            for (const auto& rayResult : proximitySensorSystem->GetSensorRayResults(GetEntityId()))
+            {
+                auto& linePoints = rayResult.m_hit ? hitLinePoints : missLinePoints;
+                linePoints.push_back(rayResult.m_start);
+                linePoints.push_back(rayResult.m_end);
+            }
 
-            if (m_position)
+            const uint8_t pixelSize = 5;
+            AZ::RPI::AuxGeomDraw::AuxGeomDynamicDrawArguments drawArgs;
+            drawArgs.m_colorCount = 1;
+            drawArgs.m_opacityType = AZ::RPI::AuxGeomDraw::OpacityType::Opaque;
+            drawArgs.m_size = pixelSize;
+            if (!hitLinePoints.empty())
             {
-                ProximitySensorNotificationBus::Event(GetEntityId(), &ProximitySensorNotifications::OnObjectInRange);
+                drawArgs.m_colors = &AZ::Colors::Green;
+                drawArgs.m_verts = hitLinePoints.data();
+                drawArgs.m_vertCount = hitLinePoints.size();
+                m_drawQueue->DrawLines(drawArgs);
             }
-            else
+            if (!missLinePoints.empty())
             {
-                ProximitySensorNotificationBus::Event(GetEntityId(), &ProximitySensorNotifications::OnObjectOutOfRange);
+                drawArgs.m_colors = &AZ::Colors::Red;
+                drawArgs.m_verts = missLinePoints.data();
+                drawArgs.m_vertCount = missLinePoints.size();
+                m_drawQueue->DrawLines(drawArgs);
             }
         }
     }
+
+    void ProximitySensor::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        Visualize();
+    }
 } // namespace WarehouseAutomation
@@ -11,17 +11,29 @@
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Component/TransformBus.h>
 #include <AzCore/Math/Vector3.h>
+#include <ProximitySensor/ProximitySensorSystemInterface.h>
 
 namespace WarehouseAutomation
 {
     //! Simple proximity sensor based on raycasting
     //! This component publishes a bool topic depending on the object presence
+    //! The sensor casts one or more rays, arranged in a fan or a beam, and detects an object if any ray hits.
+    //! Detection checks of all sensors are done by the ProximitySensorSystemComponent, this component registers the sensor there.
     class ProximitySensor
         : public AZ::Component
         , public AZ::TickBus::Handler
+        , public AZ::TransformNotificationBus::Handler
     {
     public:
+        //! Arrangement of rays of the sensor.
+        enum class RayPattern
+        {
+            Fan, //!< Rays cast from the sensor's origin, spread evenly over the fan angle in the XY plane.
+            Beam //!< Parallel rays along the X axis, spread evenly over the beam width along the Y axis.
+        };
+
         AZ_COMPONENT(ProximitySensor, "{1f7b51f6-9450-4da4-9636-672a056e8812}", AZ::Component);
         ProximitySensor();
         ~ProximitySensor() = default;
@@ -33,22 +45,39 @@ namespace WarehouseAutomation
         void Deactivate() override;
         //////////////////////////////////////////////////////////////////////////
 
+        //! Rays of a sensor in its local frame.
+        //! @param rayPattern arrangement of rays
+        //! @param rayCount number of rays, at least one ray is returned
+        //! @param fanAngle angle between outermost rays of the fan, in degrees
+        //! @param beamWidth distance between outermost rays of the beam
+        //! @return rays spread evenly over the fan angle or the beam width, a single ray along the X axis if rayCount is one.
+        //! A full circle fan (360 degrees) spaces its rays by 360 / rayCount degrees, so that no two rays coincide.
+        static AZStd::vector<ProximitySensorRay> GetRays(RayPattern rayPattern, AZ::u32 rayCount, float fanAngle, float beamWidth);
+
     private:
         //////////////////////////////////////////////////////////////////////////
         // AZ::TickBus::Handler overrides
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
         //////////////////////////////////////////////////////////////////////////
 
+        //////////////////////////////////////////////////////////////////////////
+        // AZ::TransformNotificationBus::Handler overrides
+        void OnTransformChanged(const AZ::Transform& local, const AZ::Transform& world) override;
+        //////////////////////////////////////////////////////////////////////////
+
         void Visualize();
-        void DetectionCheck();
+
+        bool IsFanAngleVisible() const;
+        bool IsBeamWidthVisible() const;
 
         bool m_visualize{ true };
         float m_frequency{ 10.f };
 
-        AZ::Vector3 m_detectionDirection{ AZ::Vector3::CreateAxisX() };
         float m_detectionDistance{ 1.f };
-        std::optional<AZ::Vector3> m_position;
-        float m_timeElapsedSinceLastTick{ 0.f };
+        RayPattern m_rayPattern{ RayPattern::Fan };
+        AZ::u32 m_rayCount{ 1 };
+        float m_fanAngle{ 30.f }; //!< Angle between outermost rays of the fan, in degrees
+        float m_beamWidth{ 0.1f }; //!< Distance between outermost rays of the beam
 
         AZ::RPI::AuxGeomDrawPtr m_drawQueue;
     };
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "ProximitySensorSystemComponent.h"
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <WarehouseAutomation/ProximitySensor/ProximitySensorNotificationBus.h>
+
+namespace WarehouseAutomation
+{
+    ProximitySensorSystemComponent::ProximitySensorSystemComponent()
+    {
+        if (!ProximitySensorSystemInterface::Get())
+        {
+            ProximitySensorSystemInterface::Register(this);
+        }
+    }
+
+    ProximitySensorSystemComponent::~ProximitySensorSystemComponent()
+    {
+        if (ProximitySensorSystemInterface::Get() == this)
+        {
+            ProximitySensorSystemInterface::Unregister(this);
+        }
+    }
+
+    void ProximitySensorSystemComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<ProximitySensorSystemComponent, AZ::Component>()->Version(0);
+
+            if (AZ::EditContext* editContext = serializeContext->GetEditContext())
+            {
+                editContext
+                    ->Class<ProximitySensorSystemComponent>(
+                        "Proximity Sensor System", "Performs detection checks of all proximity sensors in batched scene queries.")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("System"))
+                    ->Attribute(AZ::Edit::Attributes::Category, "WarehouseAutomation")
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true);
+            }
+        }
+    }
+
+    void ProximitySensorSystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("ProximitySensorSystemService"));
+    }
+
+    void ProximitySensorSystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("ProximitySensorSystemService"));
+    }
+
+    void ProximitySensorSystemComponent::Activate()
+    {
+    }
+
+    void ProximitySensorSystemComponent::Deactivate()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        m_sensors.clear();
+        m_sensorIndices.clear();
+    }
+
+    void ProximitySensorSystemComponent::RegisterSensor(
+        AZ::EntityId sensorEntityId, const ProximitySensorDescription& description, const AZ::Transform& worldTransform)
+    {
+        AZ_Assert(!m_sensorIndices.contains(sensorEntityId), "Sensor %s is already registered", sensorEntityId.ToString().c_str());
+        AZ_Assert(description.m_frequency > 0.f, "ProximitySensor frequency must be greater than zero");
+        if (m_sensorIndices.contains(sensorEntityId))
+        {
+            return;
+        }
+
+        m_sensorIndices[sensorEntityId] = m_sensors.size();
+        Sensor& sensor = m_sensors.emplace_back();
+        sensor.m_entityId = sensorEntityId;
+        sensor.m_description = description;
+        sensor.m_worldTransform = worldTransform;
+        sensor.m_requests.reserve(description.m_rays.size());
+        for (size_t rayIndex = 0; rayIndex < description.m_rays.size(); ++rayIndex)
+        {
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_distance = description.m_detectionDistance;
+            sensor.m_requests.push_back(AZStd::move(request));
+        }
+        sensor.m_rayResults.resize(description.m_rays.size());
+        UpdateRequests(sensor);
+
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void ProximitySensorSystemComponent::UnregisterSensor(AZ::EntityId sensorEntityId)
+    {
+        auto indexIt = m_sensorIndices.find(sensorEntityId);
+        if (indexIt == m_sensorIndices.end())
+        {
+            return;
+        }
+        const size_t index = indexIt->second;
+        m_sensorIndices.erase(indexIt);
+
+        // keep sensors contiguous by moving the last sensor into the freed slot
+        if (index != m_sensors.size() - 1)
+        {
+            m_sensors[index] = AZStd::move(m_sensors.back());
+            m_sensorIndices[m_sensors[index].m_entityId] = index;
+        }
+        m_sensors.pop_back();
+
+        if (m_sensors.empty())
+        {
+            AZ::TickBus::Handler::BusDisconnect();
+        }
+    }
+
+    void ProximitySensorSystemComponent::SetSensorTransform(AZ::EntityId sensorEntityId, const AZ::Transform& worldTransform)
+    {
+        if (auto indexIt = m_sensorIndices.find(sensorEntityId); indexIt != m_sensorIndices.end())
+        {
+            Sensor& sensor = m_sensors[indexIt->second];
+            sensor.m_worldTransform = worldTransform;
+            UpdateRequests(sensor);
+        }
+    }
+
+    AZStd::vector<ProximitySensorRayResult> ProximitySensorSystemComponent::GetSensorRayResults(AZ::EntityId sensorEntityId) const
+    {
+        if (auto indexIt = m_sensorIndices.find(sensorEntityId); indexIt != m_sensorIndices.end())
+        {
+            return m_sensors[indexIt->second].m_rayResults;
+        }
+        return {};
+    }
+
+    bool ProximitySensorSystemComponent::IsCheckDue(Sensor& sensor, float deltaTime)
+    {
+        const float frameTime = 1.f / sensor.m_description.m_frequency;
+
+        sensor.m_timeElapsedSinceLastCheck += deltaTime;
+        if (sensor.m_timeElapsedSinceLastCheck < frameTime)
+        {
+            return false;
+        }
+
+        sensor.m_timeElapsedSinceLastCheck -= frameTime;
+        if (deltaTime > frameTime)
+        { // Frequency higher than possible, not catching
+          // up, just keep going with each frame.
+            sensor.m_timeElapsedSinceLastCheck = 0.0f;
+        }
+        return true;
+    }
+
+    void ProximitySensorSystemComponent::UpdateRequests(Sensor& sensor)
+    {
+        for (size_t rayIndex = 0; rayIndex < sensor.m_requests.size(); ++rayIndex)
+        {
+            const ProximitySensorRay& ray = sensor.m_description.m_rays[rayIndex];
+            AzPhysics::RayCastRequest& request = *sensor.m_requests[rayIndex];
+            request.m_start = sensor.m_worldTransform.TransformPoint(ray.m_origin);
+            request.m_direction = sensor.m_worldTransform.TransformVector(ray.m_direction).GetNormalized();
+
+            // until the next check, the sensor's rays are reported at their new location
+            ProximitySensorRayResult& rayResult = sensor.m_rayResults[rayIndex];
+            rayResult.m_start = request.m_start;
+            rayResult.m_end = request.m_start + request.m_direction * request.m_distance;
+            rayResult.m_hit = false;
+        }
+    }
+
+    void ProximitySensorSystemComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if (m_sceneHandle == AzPhysics::InvalidSceneHandle && sceneInterface)
+        {
+            m_sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+        }
+        if (m_sceneHandle == AzPhysics::InvalidSceneHandle)
+        {
+            return;
+        }
+
+        const AzPhysics::SceneQueryRequests& requests = CollectDueRequests(deltaTime);
+        if (requests.empty())
+        {
+            return;
+        }
+
+        ApplyQueryResults(sceneInterface->QuerySceneBatch(m_sceneHandle, requests));
+        NotifyTransitions();
+    }
+
+    const AzPhysics::SceneQueryRequests& ProximitySensorSystemComponent::CollectDueRequests(float deltaTime)
+    {
+        m_batchRequests.clear();
+        m_dueSensorIndices.clear();
+        for (size_t sensorIndex = 0; sensorIndex < m_sensors.size(); ++sensorIndex)
+        {
+            Sensor& sensor = m_sensors[sensorIndex];
+            if (IsCheckDue(sensor, deltaTime))
+            {
+                m_dueSensorIndices.push_back(sensorIndex);
+                m_batchRequests.insert(m_batchRequests.end(), sensor.m_requests.begin(), sensor.m_requests.end());
+            }
+        }
+        return m_batchRequests;
+    }
+
+    void ProximitySensorSystemComponent::ApplyQueryResults(const AzPhysics::SceneQueryHitsList& hitsList)
+    {
+        AZ_Assert(hitsList.size() == m_batchRequests.size(), "Number of scene query results does not match the number of requests");
+        if (hitsList.size() != m_batchRequests.size())
+        {
+            return;
+        }
+
+        // Results are in the order of requests, and rays of each due sensor are consecutive.
+        m_transitions.clear();
+        size_t requestIndex = 0;
+        for (const size_t sensorIndex : m_dueSensorIndices)
+        {
+            Sensor& sensor = m_sensors[sensorIndex];
+            bool objectInRange = false;
+            for (size_t rayIndex = 0; rayIndex < sensor.m_rayResults.size(); ++rayIndex)
+            {
+                const AzPhysics::RayCastRequest& request = *sensor.m_requests[rayIndex];
+                const AzPhysics::SceneQueryHits& hits = hitsList[requestIndex++];
+                ProximitySensorRayResult& rayResult = sensor.m_rayResults[rayIndex];
+                rayResult.m_hit = !hits.m_hits.empty();
+                rayResult.m_end = rayResult.m_hit ? hits.m_hits.front().m_position
+                                                  : request.m_start + request.m_direction * request.m_distance;
+                objectInRange = objectInRange || rayResult.m_hit;
+            }
+
+            if (objectInRange != sensor.m_objectInRange)
+            {
+                sensor.m_objectInRange = objectInRange;
+                m_transitions.emplace_back(sensor.m_entityId, objectInRange);
+            }
+        }
+    }
+
+    void ProximitySensorSystemComponent::NotifyTransitions()
+    {
+        // Handlers may unregister sensors, so notifications are sent once all sensors are updated.
+        for (const auto& [sensorEntityId, objectInRange] : m_transitions)
+        {
+            if (objectInRange)
+            {
+                ProximitySensorNotificationBus::Event(sensorEntityId, &ProximitySensorNotifications::OnObjectInRange);
+            }
+            else
+            {
+                ProximitySensorNotificationBus::Event(sensorEntityId, &ProximitySensorNotifications::OnObjectOutOfRange);
+            }
+        }
+        m_transitions.clear();
+    }
+} // namespace WarehouseAutomation
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include "ProximitySensorSystemInterface.h"
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+#include <AzFramework/Physics/Common/PhysicsTypes.h>
+
+namespace WarehouseAutomation
+{
+    //! System component that performs detection checks of all proximity sensors.
+    //! Rays of all sensors due for a check are cast in a single batched scene query every tick,
+    //! and ProximitySensorNotificationBus is signaled only when a sensor's detection state changes.
+    class ProximitySensorSystemComponent
+        : public AZ::Component
+        , public AZ::TickBus::Handler
+        , protected ProximitySensorSystemRequests
+    {
+    public:
+        AZ_COMPONENT(ProximitySensorSystemComponent, "{0586b39d-599f-499c-b34d-63b4144248c4}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        ProximitySensorSystemComponent();
+        ~ProximitySensorSystemComponent();
+
+    protected:
+        // AZ::Component overrides
+        void Activate() override;
+        void Deactivate() override;
+
+        // AZ::TickBus::Handler overrides
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        // ProximitySensorSystemRequests overrides
+        void RegisterSensor(
+            AZ::EntityId sensorEntityId, const ProximitySensorDescription& description, const AZ::Transform& worldTransform) override;
+        void UnregisterSensor(AZ::EntityId sensorEntityId) override;
+        void SetSensorTransform(AZ::EntityId sensorEntityId, const AZ::Transform& worldTransform) override;
+        AZStd::vector<ProximitySensorRayResult> GetSensorRayResults(AZ::EntityId sensorEntityId) const override;
+
+        //! Advance timers of all sensors and gather ray queries of sensors due for a detection check.
+        //! @param deltaTime time elapsed since the last call
+        //! @return ray queries of all due sensors, rays of each sensor are consecutive
+        const AzPhysics::SceneQueryRequests& CollectDueRequests(float deltaTime);
+
+        //! Update ray results and detection states of sensors gathered by the last CollectDueRequests call.
+        //! @param hitsList results of the ray queries, in the order of requests
+        void ApplyQueryResults(const AzPhysics::SceneQueryHitsList& hitsList);
+
+        //! Signal ProximitySensorNotificationBus for sensors whose detection state changed in the last ApplyQueryResults call.
+        void NotifyTransitions();
+
+    private:
+        //! State of a single sensor.
+        struct Sensor
+        {
+            AZ::EntityId m_entityId; //!< Entity of the proximity sensor
+            ProximitySensorDescription m_description; //!< Frequency, range and rays of the sensor
+            AZ::Transform m_worldTransform; //!< Transform of the sensor in world frame
+            float m_timeElapsedSinceLastCheck = 0.f; //!< Time since the last detection check
+            bool m_objectInRange = false; //!< Detection state reported in the last notification
+            AZStd::vector<AZStd::shared_ptr<AzPhysics::RayCastRequest>> m_requests; //!< Scene query of each ray, reused every check
+            AZStd::vector<ProximitySensorRayResult> m_rayResults; //!< Results of the last check of each ray
+        };
+
+        //! Check if the sensor is due for a detection check and advance its timer.
+        static bool IsCheckDue(Sensor& sensor, float deltaTime);
+
+        //! Update start and direction of the sensor's ray queries from its transform.
+        static void UpdateRequests(Sensor& sensor);
+
+        AZStd::vector<Sensor> m_sensors; //!< All registered sensors
+        AZStd::unordered_map<AZ::EntityId, size_t> m_sensorIndices; //!< Indices of sensors in m_sensors
+        AzPhysics::SceneHandle m_sceneHandle = AzPhysics::InvalidSceneHandle; //!< Scene handle of the scene the sensors are in
+
+        // Buffers reused every tick
+        AzPhysics::SceneQueryRequests m_batchRequests; //!< Ray queries of all sensors due for a check
+        AZStd::vector<size_t> m_dueSensorIndices; //!< Indices of sensors whose rays are in m_batchRequests
+        AZStd::vector<AZStd::pair<AZ::EntityId, bool>> m_transitions; //!< Sensors whose detection state changed
+    };
+} // namespace WarehouseAutomation
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace WarehouseAutomation
+{
+    //! A single ray of a proximity sensor, in sensor's local frame.
+    struct ProximitySensorRay
+    {
+        AZ::Vector3 m_origin = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_direction = AZ::Vector3::CreateAxisX(); //!< Normalized direction of the ray
+    };
+
+    //! Description of a proximity sensor registered in the ProximitySensorSystemComponent.
+    struct ProximitySensorDescription
+    {
+        float m_frequency = 10.f; //!< Detection frequency
+        float m_detectionDistance = 1.f; //!< The maximum distance from where object is detected
+        AZStd::vector<ProximitySensorRay> m_rays; //!< Rays cast by the sensor, an object is detected if any ray hits
+    };
+
+    //! Result of the last detection check of a single ray, in world frame.
+    struct ProximitySensorRayResult
+    {
+        AZ::Vector3 m_start = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_end = AZ::Vector3::CreateZero(); //!< Hit position, or the end of the ray if nothing was hit
+        bool m_hit = false;
+    };
+
+    //! Interface of the ProximitySensorSystemComponent, which performs detection checks of all proximity sensors.
+    //! Sensors are identified by their entity.
+    class ProximitySensorSystemRequests
+    {
+    public:
+        AZ_RTTI(ProximitySensorSystemRequests, "{f05b4743-3edf-4f2b-a393-2229d30e76e5}");
+
+        //! Register a sensor. The sensor starts with no object in range.
+        //! @param sensorEntityId entity of the proximity sensor
+        //! @param description frequency, range and rays of the sensor
+        //! @param worldTransform transform of the sensor in world frame
+        virtual void RegisterSensor(
+            AZ::EntityId sensorEntityId, const ProximitySensorDescription& description, const AZ::Transform& worldTransform) = 0;
+
+        //! Stop detection checks of a sensor.
+        //! @param sensorEntityId entity of the proximity sensor
+        virtual void UnregisterSensor(AZ::EntityId sensorEntityId) = 0;
+
+        //! Update the transform of a registered sensor.
+        //! @param sensorEntityId entity of the proximity sensor
+        //! @param worldTransform transform of the sensor in world frame
+        virtual void SetSensorTransform(AZ::EntityId sensorEntityId, const AZ::Transform& worldTransform) = 0;
+
+        //! Obtain results of the last detection check of a sensor, eg for visualization.
+        //! @param sensorEntityId entity of the proximity sensor
+        //! @return results of all rays of the sensor, empty if the sensor is not registered
+        virtual AZStd::vector<ProximitySensorRayResult> GetSensorRayResults(AZ::EntityId sensorEntityId) const = 0;
+
+    protected:
+        ~ProximitySensorSystemRequests() = default;
+    };
+
+    using ProximitySensorSystemInterface = AZ::Interface<ProximitySensorSystemRequests>;
+} // namespace WarehouseAutomation
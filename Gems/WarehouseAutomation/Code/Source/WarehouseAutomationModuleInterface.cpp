@@ -8,7 +8,9 @@
 #include "WarehouseAutomationModuleInterface.h"
 #include <AzCore/Memory/Memory.h>
 #include <ConveyorBelt/ConveyorBeltComponent.h>
+#include <ConveyorBelt/ConveyorBeltSystemComponent.h>
 #include <ProximitySensor/ProximitySensor.h>
+#include <ProximitySensor/ProximitySensorSystemComponent.h>
 
 namespace WarehouseAutomation
 {
@@ -23,7 +25,17 @@ namespace WarehouseAutomation
             m_descriptors.end(),
             {
                 ConveyorBeltComponent::CreateDescriptor(),
+                ConveyorBeltSystemComponent::CreateDescriptor(),
                 ProximitySensor::CreateDescriptor(),
+                ProximitySensorSystemComponent::CreateDescriptor(),
             });
     }
+
+    AZ::ComponentTypeList WarehouseAutomationModuleInterface::GetRequiredSystemComponents() const
+    {
+        return AZ::ComponentTypeList{
+            azrtti_typeid<ConveyorBeltSystemComponent>(),
+            azrtti_typeid<ProximitySensorSystemComponent>(),
+        };
+    }
 } // namespace WarehouseAutomation
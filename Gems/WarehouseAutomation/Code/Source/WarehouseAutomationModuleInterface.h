@@ -20,5 +20,7 @@ namespace WarehouseAutomation
         AZ_CLASS_ALLOCATOR_DECL
 
         WarehouseAutomationModuleInterface();
+
+        AZ::ComponentTypeList GetRequiredSystemComponents() const override;
     };
 } // namespace WarehouseAutomation
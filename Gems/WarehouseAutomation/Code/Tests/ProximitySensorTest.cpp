@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/math.h>
+#include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+#include <AzTest/AzTest.h>
+
+#include <ProximitySensor/ProximitySensor.h>
+#include <ProximitySensor/ProximitySensorSystemComponent.h>
+#include <WarehouseAutomation/ProximitySensor/ProximitySensorNotificationBus.h>
+
+namespace UnitTest
+{
+    //! Exposes detection steps of the system component, so that they can be run without a physics scene.
+    class TestProximitySensorSystemComponent : public WarehouseAutomation::ProximitySensorSystemComponent
+    {
+    public:
+        using ProximitySensorSystemComponent::ApplyQueryResults;
+        using ProximitySensorSystemComponent::CollectDueRequests;
+        using ProximitySensorSystemComponent::GetSensorRayResults;
+        using ProximitySensorSystemComponent::NotifyTransitions;
+        using ProximitySensorSystemComponent::RegisterSensor;
+        using ProximitySensorSystemComponent::SetSensorTransform;
+        using ProximitySensorSystemComponent::UnregisterSensor;
+    };
+
+    //! Counts notifications of a single sensor.
+    class ProximitySensorNotificationCounter : public WarehouseAutomation::ProximitySensorNotificationBus::Handler
+    {
+    public:
+        explicit ProximitySensorNotificationCounter(AZ::EntityId sensorEntityId)
+        {
+            BusConnect(sensorEntityId);
+        }
+
+        ~ProximitySensorNotificationCounter()
+        {
+            BusDisconnect();
+        }
+
+        void OnObjectInRange() override
+        {
+            ++m_inRangeCount;
+        }
+
+        void OnObjectOutOfRange() override
+        {
+            ++m_outOfRangeCount;
+        }
+
+        AZ::u32 m_inRangeCount = 0;
+        AZ::u32 m_outOfRangeCount = 0;
+    };
+
+    class ProximitySensorTest : public LeakDetectionFixture
+    {
+    public:
+        using RayPattern = WarehouseAutomation::ProximitySensor::RayPattern;
+
+        //! Sensor with a single ray, checked on every call with a 0.1s delta time.
+        static WarehouseAutomation::ProximitySensorDescription CreateDescription()
+        {
+            WarehouseAutomation::ProximitySensorDescription description;
+            description.m_frequency = 10.f;
+            description.m_detectionDistance = 2.f;
+            description.m_rays.resize(1);
+            return description;
+        }
+
+        //! Results of the ray queries, a hit at the given position for rays in hitPositions, no hit for others.
+        static AzPhysics::SceneQueryHitsList CreateHits(
+            size_t rayCount, const AZStd::vector<AZStd::pair<size_t, AZ::Vector3>>& hitPositions)
+        {
+            AzPhysics::SceneQueryHitsList hitsList(rayCount);
+            for (const auto& [rayIndex, position] : hitPositions)
+            {
+                AzPhysics::SceneQueryHit hit;
+                hit.m_position = position;
+                hitsList[rayIndex].m_hits.push_back(hit);
+            }
+            return hitsList;
+        }
+
+        //! Runs a detection check of all due sensors with the given results.
+        static void RunCheck(
+            TestProximitySensorSystemComponent& system, const AZStd::vector<AZStd::pair<size_t, AZ::Vector3>>& hitPositions = {})
+        {
+            const size_t requestCount = system.CollectDueRequests(0.1f).size();
+            system.ApplyQueryResults(CreateHits(requestCount, hitPositions));
+            system.NotifyTransitions();
+        }
+
+        static constexpr float Tolerance = 1e-5f;
+    };
+
+    TEST_F(ProximitySensorTest, SingleRayPointsAlongAxisX)
+    {
+        for (const RayPattern rayPattern : { RayPattern::Fan, RayPattern::Beam })
+        {
+            // Ray count of zero is treated as one ray.
+            for (const AZ::u32 rayCount : { 0u, 1u })
+            {
+                const auto rays = WarehouseAutomation::ProximitySensor::GetRays(rayPattern, rayCount, 90.f, 1.f);
+                ASSERT_EQ(rays.size(), 1u);
+                EXPECT_TRUE(rays[0].m_origin.IsClose(AZ::Vector3::CreateZero(), Tolerance));
+                EXPECT_TRUE(rays[0].m_direction.IsClose(AZ::Vector3::CreateAxisX(), Tolerance));
+            }
+        }
+    }
+
+    TEST_F(ProximitySensorTest, FanRaysSpreadOverFanAngle)
+    {
+        const auto rays = WarehouseAutomation::ProximitySensor::GetRays(RayPattern::Fan, 3, 90.f, 1.f);
+        ASSERT_EQ(rays.size(), 3u);
+
+        const float angle = AZ::DegToRad(45.f);
+        EXPECT_TRUE(rays[0].m_direction.IsClose(AZ::Vector3(AZStd::cos(angle), -AZStd::sin(angle), 0.f), Tolerance));
+        EXPECT_TRUE(rays[1].m_direction.IsClose(AZ::Vector3::CreateAxisX(), Tolerance));
+        EXPECT_TRUE(rays[2].m_direction.IsClose(AZ::Vector3(AZStd::cos(angle), AZStd::sin(angle), 0.f), Tolerance));
+        for (const auto& ray : rays)
+        {
+            EXPECT_TRUE(ray.m_origin.IsClose(AZ::Vector3::CreateZero(), Tolerance));
+            EXPECT_NEAR(ray.m_direction.GetLength(), 1.f, Tolerance);
+        }
+    }
+
+    TEST_F(ProximitySensorTest, FullCircleFanRaysDoNotCoincide)
+    {
+        const auto rays = WarehouseAutomation::ProximitySensor::GetRays(RayPattern::Fan, 4, 360.f, 1.f);
+        ASSERT_EQ(rays.size(), 4u);
+
+        EXPECT_TRUE(rays[0].m_direction.IsClose(-AZ::Vector3::CreateAxisX(), Tolerance));
+        EXPECT_TRUE(rays[1].m_direction.IsClose(-AZ::Vector3::CreateAxisY(), Tolerance));
+        EXPECT_TRUE(rays[2].m_direction.IsClose(AZ::Vector3::CreateAxisX(), Tolerance));
+        EXPECT_TRUE(rays[3].m_direction.IsClose(AZ::Vector3::CreateAxisY(), Tolerance));
+    }
+
+    TEST_F(ProximitySensorTest, BeamRaysSpreadOverBeamWidth)
+    {
+        const auto rays = WarehouseAutomation::ProximitySensor::GetRays(RayPattern::Beam, 5, 90.f, 0.4f);
+        ASSERT_EQ(rays.size(), 5u);
+
+        for (size_t rayIndex = 0; rayIndex < rays.size(); ++rayIndex)
+        {
+            const float expectedY = -0.2f + 0.1f * aznumeric_cast<float>(rayIndex);
+            EXPECT_TRUE(rays[rayIndex].m_origin.IsClose(AZ::Vector3(0.f, expectedY, 0.f), Tolerance)) << "ray " << rayIndex;
+            EXPECT_TRUE(rays[rayIndex].m_direction.IsClose(AZ::Vector3::CreateAxisX(), Tolerance)) << "ray " << rayIndex;
+        }
+    }
+
+    TEST_F(ProximitySensorTest, NotificationsAreSentOnlyOnTransitions)
+    {
+        const AZ::EntityId sensorEntityId(1);
+        TestProximitySensorSystemComponent system;
+        system.RegisterSensor(sensorEntityId, CreateDescription(), AZ::Transform::CreateIdentity());
+        ProximitySensorNotificationCounter counter(sensorEntityId);
+
+        // Sensors start with no object in range.
+        RunCheck(system);
+        EXPECT_EQ(counter.m_inRangeCount, 0u);
+        EXPECT_EQ(counter.m_outOfRangeCount, 0u);
+
+        const AZ::Vector3 hitPosition(1.f, 0.f, 0.f);
+        RunCheck(system, { { 0, hitPosition } });
+        RunCheck(system, { { 0, hitPosition } });
+        EXPECT_EQ(counter.m_inRangeCount, 1u);
+        EXPECT_EQ(counter.m_outOfRangeCount, 0u);
+
+        const auto rayResults = system.GetSensorRayResults(sensorEntityId);
+        ASSERT_EQ(rayResults.size(), 1u);
+        EXPECT_TRUE(rayResults[0].m_hit);
+        EXPECT_TRUE(rayResults[0].m_end.IsClose(hitPosition, Tolerance));
+
+        RunCheck(system);
+        RunCheck(system);
+        EXPECT_EQ(counter.m_inRangeCount, 1u);
+        EXPECT_EQ(counter.m_outOfRangeCount, 1u);
+    }
+
+    TEST_F(ProximitySensorTest, SensorsAreCheckedAtTheirFrequency)
+    {
+        const AZ::EntityId sensorEntityId(1);
+        TestProximitySensorSystemComponent system;
+        system.RegisterSensor(sensorEntityId, CreateDescription(), AZ::Transform::CreateIdentity());
+
+        EXPECT_TRUE(system.CollectDueRequests(0.06f).empty());
+        EXPECT_EQ(system.CollectDueRequests(0.06f).size(), 1u);
+        EXPECT_TRUE(system.CollectDueRequests(0.06f).empty());
+    }
+
+    TEST_F(ProximitySensorTest, UnregisteringKeepsRemainingSensorsAddressable)
+    {
+        const AZ::EntityId firstEntityId(1);
+        const AZ::EntityId secondEntityId(2);
+        const AZ::EntityId lastEntityId(3);
+        TestProximitySensorSystemComponent system;
+        for (const AZ::EntityId entityId : { firstEntityId, secondEntityId, lastEntityId })
+        {
+            const float y = aznumeric_cast<float>(static_cast<AZ::u64>(entityId));
+            system.RegisterSensor(entityId, CreateDescription(), AZ::Transform::CreateTranslation(AZ::Vector3(0.f, y, 0.f)));
+        }
+        ProximitySensorNotificationCounter secondCounter(secondEntityId);
+        ProximitySensorNotificationCounter lastCounter(lastEntityId);
+
+        // The last sensor is moved into the slot of the first one.
+        system.UnregisterSensor(firstEntityId);
+        EXPECT_TRUE(system.GetSensorRayResults(firstEntityId).empty());
+        ASSERT_EQ(system.GetSensorRayResults(lastEntityId).size(), 1u);
+        EXPECT_TRUE(system.GetSensorRayResults(lastEntityId)[0].m_start.IsClose(AZ::Vector3(0.f, 3.f, 0.f), Tolerance));
+
+        system.SetSensorTransform(lastEntityId, AZ::Transform::CreateTranslation(AZ::Vector3(0.f, 4.f, 0.f)));
+        EXPECT_TRUE(system.GetSensorRayResults(lastEntityId)[0].m_start.IsClose(AZ::Vector3(0.f, 4.f, 0.f), Tolerance));
+        EXPECT_TRUE(system.GetSensorRayResults(secondEntityId)[0].m_start.IsClose(AZ::Vector3(0.f, 2.f, 0.f), Tolerance));
+
+        // Requests are gathered in the order of slots, so the first result belongs to the moved sensor.
+        const auto& requests = system.CollectDueRequests(0.1f);
+        ASSERT_EQ(requests.size(), 2u);
+        system.ApplyQueryResults(CreateHits(requests.size(), { { 0, AZ::Vector3(1.f, 4.f, 0.f) } }));
+        system.NotifyTransitions();
+        EXPECT_EQ(lastCounter.m_inRangeCount, 1u);
+        EXPECT_EQ(secondCounter.m_inRangeCount, 0u);
+
+        system.UnregisterSensor(lastEntityId);
+        system.UnregisterSensor(secondEntityId);
+        EXPECT_TRUE(system.GetSensorRayResults(secondEntityId).empty());
+        EXPECT_TRUE(system.CollectDueRequests(0.1f).empty());
+    }
+} // namespace UnitTest
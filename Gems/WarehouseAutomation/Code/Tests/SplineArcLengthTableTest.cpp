@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Spline.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+
+#include <ConveyorBelt/SplineArcLengthTable.h>
+
+namespace UnitTest
+{
+    class SplineArcLengthTableTest : public LeakDetectionFixture
+    {
+    public:
+        //! Quarter circle-like curve in the XY plane.
+        static AZ::BezierSpline CreateCurvedSpline()
+        {
+            AZ::BezierSpline spline;
+            spline.m_vertexContainer.AddVertex(AZ::Vector3(0.0f, 0.0f, 0.0f));
+            spline.m_vertexContainer.AddVertex(AZ::Vector3(2.0f, 0.5f, 0.0f));
+            spline.m_vertexContainer.AddVertex(AZ::Vector3(3.0f, 2.0f, 0.0f));
+            spline.m_vertexContainer.AddVertex(AZ::Vector3(3.5f, 4.0f, 0.0f));
+            return spline;
+        }
+
+        static constexpr float SampleDistance = 0.01f;
+        static constexpr float Tolerance = 0.01f;
+    };
+
+    TEST_F(SplineArcLengthTableTest, TransformsFollowSplineByDistance)
+    {
+        const AZ::BezierSpline spline = CreateCurvedSpline();
+        WarehouseAutomation::SplineArcLengthTable table;
+        table.Build(spline, AZ::Transform::CreateIdentity(), AZ::Vector3::CreateZero(), SampleDistance);
+        ASSERT_FALSE(table.IsEmpty());
+
+        const float length = spline.GetLength(spline.GetAddressByFraction(1.0f));
+        EXPECT_NEAR(table.GetLength(), length, Tolerance);
+
+        // Normalized distance is proportional to the distance along the spline, unlike the spline fraction.
+        constexpr int StepCount = 20;
+        for (int step = 0; step <= StepCount; ++step)
+        {
+            const float distanceNormalized = static_cast<float>(step) / StepCount;
+            const AZ::Vector3 expected = spline.GetPosition(spline.GetAddressByDistance(distanceNormalized * length));
+            const AZ::Vector3 actual = table.GetTransform(distanceNormalized).GetTranslation();
+            EXPECT_TRUE(actual.IsClose(expected, Tolerance)) << "at normalized distance " << distanceNormalized;
+        }
+    }
+
+    TEST_F(SplineArcLengthTableTest, TransformsAreClampedToSplineEnds)
+    {
+        const AZ::BezierSpline spline = CreateCurvedSpline();
+        const AZ::Transform splineTransform = AZ::Transform::CreateTranslation(AZ::Vector3(1.0f, 2.0f, 3.0f));
+        const AZ::Vector3 localOffset(0.0f, 0.0f, 0.5f);
+        WarehouseAutomation::SplineArcLengthTable table;
+        table.Build(spline, splineTransform, localOffset, SampleDistance);
+
+        const AZ::Vector3 start = splineTransform.TransformPoint(AZ::Vector3(0.0f, 0.0f, 0.0f) + localOffset);
+        const AZ::Vector3 end = splineTransform.TransformPoint(AZ::Vector3(3.5f, 4.0f, 0.0f) + localOffset);
+        EXPECT_TRUE(table.GetTransform(0.0f).GetTranslation().IsClose(start, Tolerance));
+        EXPECT_TRUE(table.GetTransform(1.0f).GetTranslation().IsClose(end, Tolerance));
+        EXPECT_TRUE(table.GetTransform(-0.5f).GetTranslation().IsClose(start, Tolerance));
+        EXPECT_TRUE(table.GetTransform(1.5f).GetTranslation().IsClose(end, Tolerance));
+
+        // Poses are oriented along the spline: the x axis is the tangent.
+        const AZ::Vector3 startTangent = spline.GetTangent(spline.GetAddressByDistance(0.0f));
+        EXPECT_TRUE(table.GetTransform(0.0f).GetBasisX().IsClose(startTangent, Tolerance));
+    }
+
+    TEST_F(SplineArcLengthTableTest, ZeroLengthSplineGivesConstantPose)
+    {
+        AZ::LinearSpline spline;
+        spline.m_vertexContainer.AddVertex(AZ::Vector3(1.0f, 1.0f, 0.0f));
+        spline.m_vertexContainer.AddVertex(AZ::Vector3(1.0f, 1.0f, 0.0f));
+        const AZ::Transform splineTransform =
+            AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationZ(1.0f), AZ::Vector3(0.0f, 0.0f, 2.0f));
+
+        WarehouseAutomation::SplineArcLengthTable table;
+        table.Build(spline, splineTransform, AZ::Vector3::CreateZero(), SampleDistance);
+        ASSERT_FALSE(table.IsEmpty());
+        EXPECT_FLOAT_EQ(table.GetLength(), 0.0f);
+
+        const AZ::Vector3 position = splineTransform.TransformPoint(AZ::Vector3(1.0f, 1.0f, 0.0f));
+        for (const float distanceNormalized : { 0.0f, 0.5f, 1.0f })
+        {
+            const AZ::Transform transform = table.GetTransform(distanceNormalized);
+            EXPECT_TRUE(transform.GetTranslation().IsClose(position, Tolerance));
+            EXPECT_TRUE(transform.GetRotation().IsClose(splineTransform.GetRotation(), Tolerance));
+        }
+    }
+
+    TEST_F(SplineArcLengthTableTest, EmptyTableGivesIdentity)
+    {
+        const WarehouseAutomation::SplineArcLengthTable table;
+        EXPECT_TRUE(table.IsEmpty());
+        EXPECT_TRUE(table.GetTransform(0.5f).IsClose(AZ::Transform::CreateIdentity()));
+    }
+} // namespace UnitTest
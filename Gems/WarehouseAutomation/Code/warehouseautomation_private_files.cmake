@@ -9,6 +9,14 @@ set(FILES
     Source/ConveyorBelt/ConveyorBeltComponent.h
     Source/ConveyorBelt/ConveyorBeltComponentConfiguration.cpp
     Source/ConveyorBelt/ConveyorBeltComponentConfiguration.h
+    Source/ConveyorBelt/ConveyorBeltSystemComponent.cpp
+    Source/ConveyorBelt/ConveyorBeltSystemComponent.h
+    Source/ConveyorBelt/ConveyorBeltSystemInterface.h
+    Source/ConveyorBelt/SplineArcLengthTable.cpp
+    Source/ConveyorBelt/SplineArcLengthTable.h
     Source/ProximitySensor/ProximitySensor.cpp
     Source/ProximitySensor/ProximitySensor.h
+    Source/ProximitySensor/ProximitySensorSystemComponent.cpp
+    Source/ProximitySensor/ProximitySensorSystemComponent.h
+    Source/ProximitySensor/ProximitySensorSystemInterface.h
 )
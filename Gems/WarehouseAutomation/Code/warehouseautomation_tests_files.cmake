@@ -3,5 +3,7 @@
 #
 # SPDX-License-Identifier: Apache-2.0 OR MIT
 set(FILES
+    Tests/ProximitySensorTest.cpp
+    Tests/SplineArcLengthTableTest.cpp
     Tests/WarehouseAutomationTest.cpp
 )